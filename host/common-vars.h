@@ -0,0 +1,13 @@
+// common-vars.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: run time options, none enabled
+
+#pragma once
+
+// ########################################### Macros ##############################################
+
+#define	appOPTIONS					1
+#define	OPT_GET(x)					0
+#define	dbgSyntax					0
+
+#define	xOptionSet(o, v)			((void) (o), (void) (v))
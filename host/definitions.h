@@ -0,0 +1,79 @@
+// definitions.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: character constants and helper macros
+
+#pragma once
+
+// ########################################### Macros ##############################################
+
+#ifndef debugFLAG_GLOBAL
+	#ifdef NDEBUG
+		#define	debugFLAG_GLOBAL	0x0000				// release build, parameter checks compiled out
+	#else
+		#define	debugFLAG_GLOBAL	0xFFFF
+	#endif
+#endif
+
+#define	INRANGE(l,x,h)				(((l) <= (x)) && ((x) <= (h)))
+#define	OUTSIDE(l,x,h)				(((x) < (l)) || ((x) > (h)))
+
+#define	BIT21MASK					(1UL << 21)
+#define	BIT22MASK					(1UL << 22)
+#define	BIT23MASK					(1UL << 23)
+#define	BIT24MASK					(1UL << 24)
+#define	BIT25MASK					(1UL << 25)
+#define	BIT26MASK					(1UL << 26)
+#define	BIT27MASK					(1UL << 27)
+#define	BIT28MASK					(1UL << 28)
+#define	BIT29MASK					(1UL << 29)
+
+#define	BASE10						10
+#define	BASE16						16
+#define	MILLION						1000000
+#define	strNL						"\r\n"
+
+#define	CHR_NUL						0x00
+#define	CHR_TAB						0x09
+#define	CHR_LF						0x0A
+#define	CHR_CR						0x0D
+#define	CHR_SPACE					0x20
+#define	CHR_DOUBLE_QUOTE			0x22
+#define	CHR_PERCENT					'%'
+#define	CHR_L_ROUND					'('
+#define	CHR_R_ROUND					')'
+#define	CHR_PLUS					'+'
+#define	CHR_COMMA					','
+#define	CHR_MINUS					'-'
+#define	CHR_FULLSTOP				'.'
+#define	CHR_FWDSLASH				'/'
+#define	CHR_COLON					':'
+#define	CHR_BACKSLASH				'\\'
+#define	CHR_UNDERSCORE				'_'
+#define	CHR_0						'0'
+#define	CHR_9						'9'
+#define	CHR_A						'A'
+#define	CHR_D						'D'
+#define	CHR_E						'E'
+#define	CHR_F						'F'
+#define	CHR_H						'H'
+#define	CHR_M						'M'
+#define	CHR_O						'O'
+#define	CHR_S						'S'
+#define	CHR_T						'T'
+#define	CHR_X						'X'
+#define	CHR_Z						'Z'
+#define	CHR_a						'a'
+#define	CHR_b						'b'
+#define	CHR_d						'd'
+#define	CHR_e						'e'
+#define	CHR_f						'f'
+#define	CHR_h						'h'
+#define	CHR_m						'm'
+#define	CHR_n						'n'
+#define	CHR_o						'o'
+#define	CHR_r						'r'
+#define	CHR_s						's'
+#define	CHR_t						't'
+#define	CHR_u						'u'
+#define	CHR_x						'x'
+#define	CHR_z						'z'
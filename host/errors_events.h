@@ -0,0 +1,17 @@
+// errors_events.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: status codes, asserts and early returns
+
+#pragma once
+
+#include <assert.h>
+
+// ########################################### Macros ##############################################
+
+#define	erSUCCESS					0
+#define	erFAILURE					-1
+#define	pcFAILURE					((char *) -1)
+
+#define	IF_myASSERT(t, x)			do { if (t) assert(x); } while (0)
+#define	IF_RETURN_X(t, x)			do { if (t) return (x); } while (0)
+#define	MARK_M(x)
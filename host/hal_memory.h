@@ -0,0 +1,10 @@
+// hal_memory.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: all memory is valid SRAM on the host
+
+#pragma once
+
+// ########################################### Macros ##############################################
+
+#define	halMemoryANY(p)				((p) != NULL)
+#define	halMemorySRAM(p)			((p) != NULL)
@@ -0,0 +1,8 @@
+// hal_platform.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: platform definitions
+
+#pragma once
+
+#include "struct_union.h"
+#include "definitions.h"
@@ -0,0 +1,87 @@
+// host_shims.c - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: value conversion and calendar helpers normally provided by other components
+
+#include "hal_platform.h"
+#include "timeX.h"
+
+// ######################################## Local variables ########################################
+
+static const u8_t u8DaysInMonth[MONTHS_IN_YEAR] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+static const char * const DayNames[DAYS_IN_WEEK] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+static const char * const MonNames[MONTHS_IN_YEAR] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+static const char * const Formats[cvSXX + 1] = {
+	"%hhu", "%hu", "%u", "%llu", "%hhd", "%hd", "%d", "%lld", "%f", "%lf", "%s"
+};
+
+// ######################################## Local functions ########################################
+
+static bool bTimeIsLeapYear(int Year) { return ((Year % 4) == 0 && (Year % 100) != 0) || (Year % 400) == 0; }
+
+// ################################# Value size/format conversion ##################################
+
+vs_e xIndex2Size(cvi_e cvI) { return (cvI >= cvF32) ? ((cvI == cvF32) ? vs32B : vs64B) : (vs_e) (cvI % 4); }
+
+vf_e xIndex2Form(cvi_e cvI) { return (cvI < cvI08) ? vfUXX : (cvI < cvF32) ? vfIXX : (cvI < cvSXX) ? vfFXX : vfSXX; }
+
+cvi_e xFormSize2Index(vf_e vf, vs_e vs) {
+	return (vf == vfUXX) ? (cvi_e) vs : (vf == vfIXX) ? (cvi_e) (cvI08 + vs) : (vs == vs32B) ? cvF32 : cvF64;
+}
+
+const char * pccIndex2Format(cvi_e cvI) { return Formats[cvI]; }
+
+void vx32ValueStore(x32_t X32, px_t pX, cvi_e cvI) {
+	switch(cvI) {
+	case cvU08: case cvI08:	*pX.pu8 = X32.u32;	break;
+	case cvU16: case cvI16:	*pX.pu16 = X32.u32;	break;
+	default:				*pX.pu32 = X32.u32;	break;
+	}
+}
+
+void vx64ValueStore(x64_t X64, px_t pX, cvi_e cvI) {
+	switch(cvI) {
+	case cvU08: case cvI08:	*pX.pu8 = X64.u64;	break;
+	case cvU16: case cvI16:	*pX.pu16 = X64.u64;	break;
+	case cvU32: case cvI32:	*pX.pu32 = X64.u64;	break;
+	case cvF32:				*pX.pf32 = X64.f64;	break;
+	default:				*pX.pu64 = X64.u64;	break;
+	}
+}
+
+// ###################################### Calendar support #########################################
+
+int	xTimeCalcDaysInMonth(tm_t * psTM) {
+	return u8DaysInMonth[psTM->tm_mon] + (psTM->tm_mon == 1 && bTimeIsLeapYear(psTM->tm_year + YEAR_BASE_MIN));
+}
+
+int	xTimeCalcDaysYTD(tm_t * psTM) {
+	int Days = psTM->tm_mday - 1;
+	bool Leap = bTimeIsLeapYear(psTM->tm_year + YEAR_BASE_MIN);
+	for (int Mon = 0; Mon < psTM->tm_mon; ++Mon)
+		Days += u8DaysInMonth[Mon] + (Mon == 1 && Leap);
+	return Days;
+}
+
+int	xTimeCalcDaysToDate(tm_t * psTM) {
+	int Days = xTimeCalcDaysYTD(psTM);
+	for (int Year = YEAR_BASE_MIN; Year < (psTM->tm_year + YEAR_BASE_MIN); ++Year)
+		Days += DAYS_IN_YEAR + bTimeIsLeapYear(Year);
+	return Days;
+}
+
+u32_t xTimeCalcSeconds(tm_t * psTM, int Rel) {
+	u32_t Secs = (psTM->tm_hour * SECONDS_IN_HOUR) + (psTM->tm_min * SECONDS_IN_MINUTE) + psTM->tm_sec;
+	u32_t Days = Rel ? (psTM->tm_year * DAYS_IN_YEAR) + psTM->tm_yday + psTM->tm_mday : xTimeCalcDaysToDate(psTM);
+	return Secs + (Days * SECONDS_IN_DAY);
+}
+
+u64_t xTimeMakeTimeStamp(u32_t Secs, u32_t uSecs) { return ((u64_t) Secs * MICROS_IN_SECOND) + uSecs; }
+
+const char * xTimeGetDayName(int Day) { return DayNames[Day]; }
+
+const char * xTimeGetMonthName(int Mon) { return MonNames[Mon]; }
@@ -0,0 +1,13 @@
+// printfx.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: console output mapped to stdio
+
+#pragma once
+
+#include <stdio.h>
+
+// ########################################### Macros ##############################################
+
+#define	PX(...)						printf(__VA_ARGS__)
+#define	IF_PX(t, ...)				do { if (t) printf(__VA_ARGS__); } while (0)
+#define	snprintfx					snprintf
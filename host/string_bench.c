@@ -0,0 +1,343 @@
+// string_bench.c - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) microbenchmark for the strings component, results as CSV on stdout
+// usage: string_bench [-q] [filter]	-q = quick (short runs), filter = substring of group or function
+
+#include "hal_platform.h"
+#include "errors_events.h"
+#include "string_general.h"
+#include "string_parse.h"
+#include "string_to_values.h"
+#include "values_to_string.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+// ########################################### Macros ##############################################
+
+#define	benchMAX_SIZE				4096				// largest variable input size
+#define	benchMIN_NSEC				20000000ULL			// minimum measuring time per case
+#define	benchQUICK_NSEC				2000000ULL
+
+// ############################################ Types ##############################################
+
+/**
+ * @brief	benchmark case, a "call" is one run of the case over the complete prepared input
+ */
+typedef struct bench_t {
+	const char * pcGroup;
+	const char * pcName;
+	const char * pcInput;								// fixed input, NULL if built for each size
+	size_t (* Prep)(size_t Size);						// build variable input, return bytes
+	size_t (* Run)(void);								// one call, result folded into sink
+} bench_t;
+
+// ######################################## Local variables ########################################
+
+static const size_t Sizes[] = { 16, 64, 256, 1024, benchMAX_SIZE };
+
+static char caSrc[benchMAX_SIZE + 64], caAlt[benchMAX_SIZE + 64], caDst[benchMAX_SIZE + 64];
+static size_t sSrc;
+static strf_t sFld[benchMAX_SIZE / 2];
+static const delim_set_t sDelim = delimSET(' ', ',', ';');
+static const delim_set_t sComma = delimSET(',');
+static volatile size_t Sink;
+static strv_t sRows[benchMAX_SIZE];
+static u64_t u64Rows[benchMAX_SIZE];
+static u32_t u32Valid[benchMAX_SIZE / 32];
+static size_t sRowCount;
+static i32_t i32Vals[benchMAX_SIZE];
+
+// ######################################## Input builders #########################################
+
+static size_t xBenchFill(const char * pPat, size_t Size) {
+	size_t Len = strlen(pPat);
+	for (size_t i = 0; i < Size; ++i)
+		caSrc[i] = pPat[i % Len];
+	caSrc[Size] = 0;
+	return sSrc = Size;
+}
+
+static size_t xPrepText(size_t Size) {
+	xBenchFill("TheQuickBrownFoxJumpsOverTheLazyDog", Size);
+	for (size_t i = 0; i <= Size; ++i)					// same text, other case, for compares
+		caAlt[i] = isupper((int) caSrc[i]) ? tolower((int) caSrc[i]) : toupper((int) caSrc[i]);
+	return Size;
+}
+
+static size_t xPrepSpaces(size_t Size) { return xBenchFill(" \t", Size); }
+
+static size_t xPrepCRLF(size_t Size) { return xBenchFill("\r\n", Size); }
+
+static size_t xPrepTokens(size_t Size) { return xBenchFill("alpha, beta;gamma  delta,", Size); }
+
+static size_t xPrepCSV(size_t Size) { return xBenchFill("12345,temp,,-6.789,", Size); }
+
+static size_t xPrepNumbers(size_t Size) {				// complete values only, ends with a ','
+	xBenchFill("12345678,-42,0x1F,1048576,7, 2147483647,", Size);
+	char * pLast = strrchr(caSrc, CHR_COMMA);
+	if (pLast)
+		pLast[1] = 0;
+	return sSrc = strlen(caSrc);
+}
+
+static size_t xPrepEncoded(size_t Size) { return xBenchFill("path%2Fto%20file.txt", Size); }
+
+static size_t xPrepJSON(size_t Size) {
+	xBenchFill("He said \\\"hi\\\"\\n\\u00e9t\\u00e9 ", Size - 1);
+	while (sSrc && caSrc[sSrc - 1] == CHR_BACKSLASH)
+		--sSrc;											// never end with a partial escape
+	caSrc[sSrc++] = CHR_DOUBLE_QUOTE;
+	caSrc[sSrc] = 0;
+	return sSrc;
+}
+
+static size_t xPrepHex(size_t Size) { return xBenchFill("0123456789ABCDEFabcdef", Size & ~1); }
+
+static size_t xPrepRows(size_t Size) {				// Size rows of log timestamps, same day
+	static char caRows[benchMAX_SIZE][sizeof("CCYY-MM-DDThh:mm:ss.fffZ")];
+	size_t Bytes = 0;
+	for (size_t Row = 0; Row < Size; ++Row) {
+		size_t Secs = Row * 7;
+		sRows[Row].pStr = caRows[Row];
+		sRows[Row].Len = snprintf(caRows[Row], sizeof(caRows[Row]), "2024-02-29T%02zu:%02zu:%02zu.%03zuZ",
+			(Secs / 3600) % 24, (Secs / 60) % 60, Secs % 60, Row % 1000);
+		Bytes += sRows[Row].Len;
+	}
+	sRowCount = Size;
+	return Bytes;
+}
+
+// ######################################### Case bodies ###########################################
+
+static size_t xRunStrnlenByte(void) { return xstrnlenByte(caSrc, sizeof(caSrc)); }
+static size_t xRunStrnlen(void) { return xstrnlen(caSrc, sizeof(caSrc)); }
+static size_t xRunStrncpyByte(void) { return xstrncpyByte(caDst, caSrc, sizeof(caDst)); }
+static size_t xRunStrncpy(void) { return xstrncpy(caDst, caSrc, sizeof(caDst)); }
+static size_t xRunStrnlenOdd(void) { return xstrnlen(caSrc + 1, sizeof(caSrc)); }				// misaligned source
+static size_t xRunStrncpyOdd(void) { return xstrncpy(caDst, caSrc + 1, sizeof(caDst)); }
+static size_t xRunStrcmpNC(void) { return xstrcmpNC(caSrc, caAlt); }
+static size_t xRunStrncmpNC(void) { return xstrncmpNC(caSrc, caAlt, sSrc); }
+static size_t xRunCountSpacesByte(void) { return xStringCountSpacesByte(caSrc); }
+static size_t xRunCountSpaces(void) { return xStringCountSpaces(caSrc); }
+static size_t xRunCountCRLFByte(void) { return xStringCountCRLFByte(caSrc); }
+static size_t xRunCountCRLF(void) { return xStringCountCRLF(caSrc); }
+static size_t xRunFindDelimN(void) { return xStringFindDelimN(caSrc, sSrc, &sDelim); }
+
+static size_t xRunToken(void) {
+	size_t Count = 0;
+	char * pNow = caSrc;
+	while (*pNow) {
+		pNow = pcStringParseTokenSet(caDst, pNow, &sDelim, 0, sizeof(caDst));
+		pNow += xStringSkipDelimN(pNow, caSrc + sSrc - pNow, &sDelim);
+		++Count;
+	}
+	return Count;
+}
+
+static size_t xRunTokenView(void) {
+	size_t Count = 0;
+	strv_t sTok;
+	char * pNow = caSrc;
+	while (*pNow) {
+		pNow = pcStringParseTokenViewSet(&sTok, pNow, &sDelim);
+		pNow += xStringSkipDelimN(pNow, caSrc + sSrc - pNow, &sDelim);
+		Count += sTok.Len;
+	}
+	return Count;
+}
+
+static size_t xRunSplit(void) {
+	return xStringSplitFields(caSrc, sSrc, &sComma, stringSPLIT_KEEP, sFld, sizeof(sFld) / sizeof(sFld[0]));
+}
+
+static size_t xRunEncoded(void) { return xStringParseEncoded(caDst, caSrc); }
+
+static size_t xRunEncodedChunk(void) {
+	enc_ctx_t sCtx;
+	size_t Used, Total = 0;
+	vStringParseEncodedInit(&sCtx, true);
+	for (size_t Ofs = 0; Ofs < sSrc; Ofs += 61) {		// odd chunk size, splits escapes
+		size_t Len = (sSrc - Ofs) < 61 ? (sSrc - Ofs) : 61;
+		Total += xStringParseEncodedChunk(&sCtx, caDst, sizeof(caDst), caSrc + Ofs, Len, &Used);
+	}
+	return Total;
+}
+
+static size_t xRunJSON(void) { return xStringParseJSON(caDst, caSrc, sizeof(caDst), NULL); }
+static size_t xRunHexBuffer(void) { return xParseHexBuffer(caSrc, sSrc, (u8_t *) caDst, sizeof(caDst)); }
+static size_t xRunHexStringN(void) { return xParseHexStringN(caSrc, sSrc, (u8_t *) caDst, sizeof(caDst)); }
+
+static size_t xRunValueU32(void) { u32_t U32; cvParseValue(caSrc, cvU32, (px_t) &U32); return U32; }
+static size_t xRunValueI64(void) { i64_t I64; cvParseValue(caSrc, cvI64, (px_t) &I64); return I64; }
+static size_t xRunValueF32(void) { f32_t F32; cvParseValue(caSrc, cvF32, (px_t) &F32); return F32; }
+static size_t xRunValueF64(void) { f64_t F64; cvParseValue(caSrc, cvF64, (px_t) &F64); return F64; }
+static size_t xRunInteger(void) { x64_t X64; pcStringParseInteger(caSrc, cvU64, &X64); return X64.u64; }
+static size_t xRunIp4(void) { u32_t U32; pcStringParseIpAddr(caSrc, (px_t) &U32); return U32; }
+static size_t xRunIp6(void) { u8_t u8A[16]; pcStringParseIp6Addr(caSrc, (px_t) u8A, NULL); return u8A[15]; }
+
+static u64_t u64Step;									// varies the formatted values
+static size_t xRunU32ToDec(void) { return xStringU32ToDec(caDst, 4294967295U - (u32_t) ++u64Step); }
+static size_t xRunU64ToDec(void) { return xStringU64ToDec(caDst, 18446744073709551615ULL - ++u64Step); }
+static size_t xRunI64ToDec(void) { return xStringI64ToDec(caDst, -9223372036854775807LL + (i64_t) ++u64Step); }
+static size_t xRunU64ToHex(void) { return xStringU64ToHex(caDst, 0xDEADBEEFCAFEF00DULL + ++u64Step, 16, true); }
+static size_t xRunValueToText(void) { u32_t U32 = 4294967295U - (u32_t) ++u64Step; return xStringValueToText(caDst, sizeof(caDst), cvU32, (px_t) &U32); }
+static size_t xRunSnprintfU64(void) { return snprintf(caDst, sizeof(caDst), "%llu", 18446744073709551615ULL - ++u64Step); }
+
+static size_t xRunParseValues(void) {
+	int Err;
+	return xStringParseValues(caSrc, &sComma, cvI32, (px_t) i32Vals, benchMAX_SIZE, NULL, &Err);
+}
+
+static size_t xRunParseValueLoop(void) {				// one cvParseValue() call per value
+	size_t Count = 0;
+	for (char * pTmp = caSrc; *pTmp; ++pTmp) {			// skip ',' after each value
+		pTmp = cvParseValue(pTmp, cvI32, (px_t) &i32Vals[Count++]);
+		if (pTmp == pcFAILURE)
+			break;
+	}
+	return Count;
+}
+
+static size_t xRunDateTime(void) {
+	u64_t TStamp;
+	tm_t sTM;
+	pcStringParseDateTime(caSrc, &TStamp, &sTM);
+	return TStamp;
+}
+
+static size_t xRunEpoch(void) {
+	u64_t TStamp;
+	pcStringParseEpoch(caSrc, &TStamp);
+	return TStamp;
+}
+
+static size_t xRunDuration(void) {
+	u64_t USecs;
+	pcStringParseDuration(caSrc, &USecs);
+	return USecs;
+}
+
+static size_t xRunFormatISO8601(void) {
+	static dt_fmt_t sFmt = { .Days = -1 };
+	static u64_t TStamp = 1709210096123456ULL;			// 2024-02-29T12:34:56.123456Z
+	TStamp += 1000;										// 1ms apart, date part mostly reused
+	return pcStringFormatISO8601(&sFmt, caDst, TStamp) - caDst;
+}
+
+static size_t xRunDateTimeCtx(void) {
+	static dt_ctx_t sCtx;								// same date every call, all hits after 1st
+	u64_t TStamp;
+	pcStringParseDateTimeCtx(&sCtx, caSrc, &TStamp, NULL);
+	return TStamp;
+}
+
+static size_t xRunDateTimeBatch(void) { return xStringParseDateTimeBatch(sRows, sRowCount, u64Rows, u32Valid); }
+
+// ######################################## Case table #############################################
+
+static const bench_t Bench[] = {
+	{ "general",	"xstrnlenByte",				NULL,	xPrepText,		xRunStrnlenByte },
+	{ "general",	"xstrnlen",					NULL,	xPrepText,		xRunStrnlen },
+	{ "general",	"xstrncpyByte",				NULL,	xPrepText,		xRunStrncpyByte },
+	{ "general",	"xstrncpy",					NULL,	xPrepText,		xRunStrncpy },
+	{ "general",	"xstrnlen(+1)",				NULL,	xPrepText,		xRunStrnlenOdd },
+	{ "general",	"xstrncpy(+1)",				NULL,	xPrepText,		xRunStrncpyOdd },
+	{ "general",	"xstrcmpNC",				NULL,	xPrepText,		xRunStrcmpNC },
+	{ "general",	"xstrncmpNC",				NULL,	xPrepText,		xRunStrncmpNC },
+	{ "general",	"xStringCountSpacesByte",	NULL,	xPrepSpaces,	xRunCountSpacesByte },
+	{ "general",	"xStringCountSpaces",		NULL,	xPrepSpaces,	xRunCountSpaces },
+	{ "general",	"xStringCountCRLFByte",		NULL,	xPrepCRLF,		xRunCountCRLFByte },
+	{ "general",	"xStringCountCRLF",			NULL,	xPrepCRLF,		xRunCountCRLF },
+	{ "general",	"xStringFindDelimN",		NULL,	xPrepText,		xRunFindDelimN },
+	{ "tokenizer",	"pcStringParseTokenSet",	NULL,	xPrepTokens,	xRunToken },
+	{ "tokenizer",	"pcStringParseTokenViewSet",NULL,	xPrepTokens,	xRunTokenView },
+	{ "tokenizer",	"xStringSplitFields",		NULL,	xPrepCSV,		xRunSplit },
+	{ "decoder",	"xStringParseEncoded",		NULL,	xPrepEncoded,	xRunEncoded },
+	{ "decoder",	"xStringParseEncodedChunk",	NULL,	xPrepEncoded,	xRunEncodedChunk },
+	{ "decoder",	"xStringParseJSON",			NULL,	xPrepJSON,		xRunJSON },
+	{ "decoder",	"xParseHexBuffer",			NULL,	xPrepHex,		xRunHexBuffer },
+	{ "decoder",	"xParseHexStringN",			NULL,	xPrepHex,		xRunHexStringN },
+	{ "numeric",	"cvParseValue(U32)",		"4294967295",						NULL, xRunValueU32 },
+	{ "numeric",	"cvParseValue(I64)",		"-9223372036854775807",				NULL, xRunValueI64 },
+	{ "numeric",	"cvParseValue(F32)",		"-273.15",							NULL, xRunValueF32 },
+	{ "numeric",	"cvParseValue(F64)",		"-12345.678901234",					NULL, xRunValueF64 },
+	{ "numeric",	"cvParseValue(F64 slow)",	"2.2250738585072011e-308",			NULL, xRunValueF64 },
+	{ "numeric",	"pcStringParseInteger(hex)","0xDEADBEEFCAFEF00D",				NULL, xRunInteger },
+	{ "numeric",	"pcStringParseIpAddr",		"192.168.100.200",					NULL, xRunIp4 },
+	{ "numeric",	"pcStringParseIp6Addr",		"2001:db8:85a3::8a2e:370:7334",		NULL, xRunIp6 },
+	{ "numeric",	"xStringParseValues(I32)",	NULL,	xPrepNumbers,	xRunParseValues },
+	{ "numeric",	"cvParseValue(I32) loop",	NULL,	xPrepNumbers,	xRunParseValueLoop },
+	{ "format",		"xStringU32ToDec",			"4294967295",						NULL, xRunU32ToDec },	// output size
+	{ "format",		"xStringU64ToDec",			"18446744073709551615",				NULL, xRunU64ToDec },
+	{ "format",		"xStringI64ToDec",			"-9223372036854775807",				NULL, xRunI64ToDec },
+	{ "format",		"xStringU64ToHex",			"DEADBEEFCAFEF00D",					NULL, xRunU64ToHex },
+	{ "format",		"xStringValueToText(U32)",	"4294967295",						NULL, xRunValueToText },
+	{ "format",		"snprintf(%llu)",			"18446744073709551615",				NULL, xRunSnprintfU64 },
+	{ "date",		"pcStringParseDateTime(iso)","2024-02-29T12:34:56.123456Z",		NULL, xRunDateTime },
+	{ "date",		"pcStringParseEpoch(iso)",	"2024-02-29T12:34:56.123456Z",		NULL, xRunEpoch },
+	{ "date",		"pcStringParseDateTimeCtx(iso)","2024-02-29T12:34:56.123456Z",		NULL, xRunDateTimeCtx },
+	{ "date",		"xStringParseDateTimeBatch",NULL,	xPrepRows,		xRunDateTimeBatch },
+	{ "date",		"pcStringParseDateTime(flex)","2024/02/29 12h34m56s",			NULL, xRunDateTime },
+	{ "date",		"pcStringParseDateTime(http)","Thu, 29 Feb 2024 12:34:56 GMT",	NULL, xRunDateTime },
+	{ "date",		"pcStringParseEpoch(http)",	"Thu, 29 Feb 2024 12:34:56 GMT",	NULL, xRunEpoch },
+	{ "date",		"pcStringParseDateTime(rel)","1234567",							NULL, xRunDateTime },
+	{ "date",		"pcStringParseDuration",	"1d2h3m4.5s",						NULL, xRunDuration },
+	{ "date",		"pcStringFormatISO8601",	"2024-02-29T12:34:56.123456Z",		NULL, xRunFormatISO8601 },	// output size
+};
+
+// ######################################## Measurement ############################################
+
+static u64_t xBenchNanos(void) {
+	struct timespec sTS;
+	clock_gettime(CLOCK_MONOTONIC, &sTS);
+	return ((u64_t) sTS.tv_sec * 1000000000ULL) + sTS.tv_nsec;
+}
+
+/**
+ * @brief	double the number of calls until the minimum measuring time is reached, report as CSV
+ */
+static void vBenchRun(const bench_t * psB, size_t Bytes, u64_t tMin) {
+	u64_t Calls = 1, tRun;
+	while (1) {
+		u64_t tNow = xBenchNanos();
+		for (u64_t i = 0; i < Calls; ++i)
+			Sink += psB->Run();
+		tRun = xBenchNanos() - tNow;
+		if (tRun >= tMin)
+			break;
+		Calls <<= 1;
+	}
+	double nsCall = (double) tRun / Calls;
+	printf("%s,%s,%zu,%llu,%.2f,%.2f\n", psB->pcGroup, psB->pcName, Bytes, (unsigned long long) Calls,
+		nsCall, ((double) Bytes * 1000.0) / nsCall);	// bytes/ns * 1000 = MB/s
+}
+
+int main(int argc, char * argv[]) {
+	u64_t tMin = benchMIN_NSEC;
+	const char * pFilter = NULL;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-q") == 0)
+			tMin = benchQUICK_NSEC;
+		else
+			pFilter = argv[i];
+	}
+	printf("group,function,bytes,calls,ns_call,mb_s\n");
+	for (size_t Idx = 0; Idx < sizeof(Bench) / sizeof(Bench[0]); ++Idx) {
+		const bench_t * psB = &Bench[Idx];
+		if (pFilter && strstr(psB->pcGroup, pFilter) == NULL && strstr(psB->pcName, pFilter) == NULL)
+			continue;
+		if (psB->pcInput) {								// fixed input, single size
+			sSrc = strlen(psB->pcInput);
+			memcpy(caSrc, psB->pcInput, sSrc + 1);
+			vBenchRun(psB, sSrc, tMin);
+			continue;
+		}
+		for (size_t i = 0; i < sizeof(Sizes) / sizeof(Sizes[0]); ++i)
+			vBenchRun(psB, psB->Prep(Sizes[i]), tMin);
+	}
+	return (Sink == 0x5A5A5A5A) ? EXIT_FAILURE : EXIT_SUCCESS;	// keep results live
+}
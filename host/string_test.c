@@ -0,0 +1,11 @@
+// string_test.c - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) runner for x_string_general_test(), tests selected by stringTEST_FLAG at build time
+
+#include "hal_platform.h"
+#include "string_parse.h"
+
+int main(void) {
+	x_string_general_test();
+	return 0;
+}
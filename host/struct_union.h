@@ -0,0 +1,53 @@
+// struct_union.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: basic types and value unions, subset used by the strings component
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ############################################ Types ##############################################
+
+typedef uint8_t u8_t;
+typedef uint16_t u16_t;
+typedef uint32_t u32_t;
+typedef uint64_t u64_t;
+typedef int8_t i8_t;
+typedef int16_t i16_t;
+typedef int32_t i32_t;
+typedef int64_t i64_t;
+typedef float f32_t;
+typedef double f64_t;
+
+typedef union x32_t { u32_t u32; i32_t i32; f32_t f32; } x32_t;
+typedef union x64_t { u64_t u64; i64_t i64; f64_t f64; } x64_t;
+
+typedef union px_t {
+	void * pv; char * pc;
+	u8_t * pu8; i8_t * pi8; u16_t * pu16; i16_t * pi16;
+	u32_t * pu32; i32_t * pi32; u64_t * pu64; i64_t * pi64;
+	f32_t * pf32; f64_t * pf64; x32_t * px32; x64_t * px64;
+} px_t;
+
+typedef enum { vfUXX, vfIXX, vfFXX, vfSXX } vf_e;
+typedef enum { vs08B, vs16B, vs32B, vs64B } vs_e;
+typedef enum { cvU08, cvU16, cvU32, cvU64, cvI08, cvI16, cvI32, cvI64, cvF32, cvF64, cvSXX } cvi_e;
+
+// ###################################### Public functions #########################################
+
+vs_e xIndex2Size(cvi_e cvI);
+vf_e xIndex2Form(cvi_e cvI);
+cvi_e xFormSize2Index(vf_e vf, vs_e vs);
+const char * pccIndex2Format(cvi_e cvI);
+void vx32ValueStore(x32_t X32, px_t pX, cvi_e cvI);
+void vx64ValueStore(x64_t X64, px_t pX, cvi_e cvI);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+// timeX.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+// Host (Linux) build shim: time constants and calendar helpers
+
+#pragma once
+
+#include "struct_union.h"
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ########################################### Macros ##############################################
+
+#define	YEAR_BASE_MIN				1970
+#define	YEAR_BASE_MAX				2106
+#define	MONTHS_IN_YEAR				12
+#define	DAYS_IN_WEEK				7
+#define	DAYS_IN_YEAR				365
+#define	HOURS_IN_DAY				24
+#define	HOURS_IN_YEAR				8760
+#define	MINUTES_IN_HOUR				60
+#define	MINUTES_IN_YEAR				525600
+#define	SECONDS_IN_MINUTE			60
+#define	SECONDS_IN_HOUR				3600
+#define	SECONDS_IN_DAY				86400
+#define	SECONDS_IN_LEAPYEAR			31622400
+#define	MICROS_IN_SECOND			1000000
+#define	MILLIS_IN_SECOND			1000
+#define	SECONDS_IN_EPOCH_PAST		0
+#define	SECONDS_IN_EPOCH_FUTURE		0xFFFFFFFFUL
+#define	timeEPOCH_DAY_0_NUM			4					// 1970/01/01 was a Thursday
+
+// ############################################ Types ##############################################
+
+typedef struct tm tm_t;
+
+typedef struct tsz_t {									// timestamp, time zone not supported
+	u64_t usecs;
+} tsz_t;
+
+// ###################################### Public functions #########################################
+
+int	xTimeCalcDaysInMonth(tm_t * psTM);
+int	xTimeCalcDaysYTD(tm_t * psTM);
+int	xTimeCalcDaysToDate(tm_t * psTM);
+u32_t xTimeCalcSeconds(tm_t * psTM, int Rel);
+u64_t xTimeMakeTimeStamp(u32_t Secs, u32_t uSecs);
+const char * xTimeGetDayName(int Day);
+const char * xTimeGetMonthName(int Mon);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,6 +6,7 @@
 #include "errors_events.h"
 #include "string_general.h"
 #include "string_to_values.h"
+#include "string_swar.h"
 #include "common-vars.h"
 
 #include <string.h>
@@ -13,7 +14,7 @@
 
 // ########################################### Macros ##############################################
 
-#define	debugFLAG					0xF000
+#define	debugFLAG					0xE000
 #define	debugDELIM					(debugFLAG & 0x0200)
 #define	debugTIMING					(debugFLAG_GLOBAL & debugFLAG & 0x1000)
 #define	debugTRACK					(debugFLAG_GLOBAL & debugFLAG & 0x2000)
@@ -24,6 +25,115 @@
 	#define	stringMAX_LEN			2048
 #endif
 
+#include "string_timing.h"								// after debugTIMING
+
+// ######################################## Local variables ########################################
+
+/**
+ * @brief	ASCII case fold table, XOR with the character to convert lower to upper case
+ */
+static const u8_t u8FoldTable[256] = { [CHR_a ... CHR_z] = 0x20 };
+
+// ######################################## Local functions ########################################
+
+/**
+ * @brief	common compare kernel, specialised by the compiler for each constant value of Fold
+ * @param	xL - maximum length to compare, SIZE_MAX for terminated strings
+ * @return	1 if the same (strncmp() == 0 semantics), else 0
+ */
+static inline __attribute__((always_inline)) swarKERNEL int xStringCompare(const char * s1, const char * s2, size_t xL, bool Fold) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)s1) && halMemoryANY((void *)s2));
+#if (stringSWAR == 1)
+	while (xL) {
+		if (swarALIGNED(s1) && xL >= swarSIZE && swarPAGE_SAFE(s2)) {
+			swar_t X = *(const swar_t *) s1, Y;
+			memcpy(&Y, s2, swarSIZE);					// s2 may be unaligned
+			if (xSwarZero(X) == 0) {					// NUL in word, resolve byte by byte
+				swar_t D = X ^ Y;
+				if (D && (Fold == false || bSwarFoldEqual(X, D) == false))
+					return 0;
+				s1 += swarSIZE;
+				s2 += swarSIZE;
+				xL -= swarSIZE;
+				continue;
+			}
+		}
+#else
+	while (xL) {
+#endif
+		u8_t c1 = *s1++, c2 = *s2++;
+		if (Fold) {
+			c1 ^= u8FoldTable[c1];
+			c2 ^= u8FoldTable[c2];
+		}
+		if (c1 != c2)
+			return 0;
+		if (c1 == 0)
+			return 1;
+		--xL;
+	}
+	return 1;
+}
+
+/**
+ * @brief	case insensitive FNV-1a hash of a terminated string
+ */
+static u32_t xStringHashKey(const char * pKey) {
+	u32_t Hash = 2166136261UL;
+	while (*pKey) {
+		Hash ^= (u8_t) toupper((int) *pKey++);
+		Hash *= 16777619UL;
+	}
+	return Hash;
+}
+
+/**
+ * @brief	derive the slot for a key hash and bucket seed, no further pass over the key
+ */
+static u32_t xStringHashSlot(u32_t Hash, u16_t Seed, u16_t Count) {
+	Hash += Seed * 0x9E3779B9UL;						// murmur3 finaliser
+	Hash ^= Hash >> 16;
+	Hash *= 0x85EBCA6BUL;
+	Hash ^= Hash >> 13;
+	Hash *= 0xC2B2AE35UL;
+	Hash ^= Hash >> 16;
+	return Hash % Count;
+}
+
+/**
+ * @brief	follow key through the trie
+ * @return	index of node reached, 0 (root) if Len is 0 or erFAILURE if no such path
+ */
+static int xStringTrieWalk(const strtrie_t * psTrie, const char * pKey, size_t Len) {
+	int Node = 0;
+	if (Len == 0)
+		Len = strlen(pKey);
+	while (Len--) {
+		char cChr = toupper((int) *pKey++);
+		Node = psTrie->psNode[Node].Child;
+		while (Node && psTrie->psNode[Node].Chr < cChr)
+			Node = psTrie->psNode[Node].Next;
+		if (Node == 0 || psTrie->psNode[Node].Chr != cChr)
+			return erFAILURE;
+	}
+	return Node;
+}
+
+/**
+ * @brief	collect keyword indexes at and below a node, depth first in sibling order
+ */
+static int xStringTrieCollect(const strtrie_t * psTrie, int Node, u16_t * pIdx, int Max, int Count) {
+	const strnode_t * psNode = &psTrie->psNode[Node];
+	if (psNode->Key >= 0) {
+		if (Count < Max)
+			pIdx[Count] = psNode->Key;
+		++Count;
+	}
+	for (Node = psNode->Child; Node; Node = psTrie->psNode[Node].Next)
+		Count = xStringTrieCollect(psTrie, Node, pIdx, Max, Count);
+	return Count;
+}
+
 // ###################################### Public functions #########################################
 
 int	xstrverify(char * pStr, char cMin, char cMax, char cNum) {
@@ -36,7 +146,7 @@ int	xstrverify(char * pStr, char cMin, char cMax, char cNum) {
 	return erSUCCESS;
 }
 
-size_t xstrnlen(const char * pStr, size_t uMax) {
+size_t xstrnlenByte(const char * pStr, size_t uMax) {
 	IF_myASSERT(debugPARAM, halMemoryANY((void *)pStr));
 	IF_myASSERT(debugPARAM, uMax > 0);
 	size_t uNow;
@@ -44,7 +154,7 @@ size_t xstrnlen(const char * pStr, size_t uMax) {
 	return uNow;
 }
 
-int	xstrncpy(char * pDst, char * pSrc, int xLen ) {
+int	xstrncpyByte(char * pDst, char * pSrc, int xLen ) {
 	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pDst) && halMemoryANY((void*) pSrc) && xLen);
 	int Cnt = 0;
 	while (*pSrc != 0 && Cnt < xLen) {
@@ -56,6 +166,65 @@ int	xstrncpy(char * pDst, char * pSrc, int xLen ) {
 	return Cnt;
 }
 
+#if (stringSWAR == 1)
+swarKERNEL size_t xstrnlen(const char * pStr, size_t uMax) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)pStr));
+	IF_myASSERT(debugPARAM, uMax > 0);
+	const char * pNow = pStr;
+	while (uMax && !swarALIGNED(pNow)) {				// bytes up to word boundary
+		if (*pNow == 0)
+			return pNow - pStr;
+		++pNow;
+		--uMax;
+	}
+	while (uMax >= swarSIZE) {							// aligned words
+		swar_t Mask = xSwarZero(*(const swar_t *) pNow);
+		if (Mask)
+			return (pNow - pStr) + xSwarFirst(Mask);
+		pNow += swarSIZE;
+		uMax -= swarSIZE;
+	}
+	while (uMax && *pNow) {								// remaining tail bytes
+		++pNow;
+		--uMax;
+	}
+	return pNow - pStr;
+}
+
+swarKERNEL int xstrncpy(char * pDst, char * pSrc, int xLen ) {
+	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pDst) && halMemoryANY((void*) pSrc) && xLen);
+	int Cnt = 0;
+	while (Cnt < xLen && !swarALIGNED(pSrc)) {			// source bytes up to word boundary
+		if (*pSrc == 0)
+			break;
+		*pDst++ = *pSrc++;
+		++Cnt;
+	}
+	if (swarALIGNED(pSrc)) {
+		while ((xLen - Cnt) >= (int) swarSIZE) {		// whole words without a NUL
+			swar_t Word = *(const swar_t *) pSrc;
+			if (xSwarZero(Word))
+				break;
+			memcpy(pDst, &Word, swarSIZE);				// destination may be unaligned
+			pDst += swarSIZE;
+			pSrc += swarSIZE;
+			Cnt += swarSIZE;
+		}
+	}
+	while (*pSrc != 0 && Cnt < xLen) {					// tail, including word with NUL
+		*pDst++ = *pSrc++;
+		++Cnt;
+	}
+	if (Cnt < xLen)
+		*pDst = 0;										// if space left, terminate
+	return Cnt;
+}
+#else
+size_t xstrnlen(const char * pStr, size_t uMax) { return xstrnlenByte(pStr, uMax); }
+
+int	xstrncpy(char * pDst, char * pSrc, int xLen ) { return xstrncpyByte(pDst, pSrc, xLen); }
+#endif
+
 int	xmemrev(char * pMem, size_t Size) {
 	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pMem) && Size > 1);
 	if (pMem == NULL || Size < 2) return erFAILURE;
@@ -84,44 +253,32 @@ int	strchr_i(const char * pStr, int iChr) {
 	return pTmp ? pTmp - pStr : erFAILURE;
 }
 
+swarKERNEL int xstrncmpExact(const char * s1, const char * s2, size_t xL) { return xStringCompare(s1, s2, xL ? xL : SIZE_MAX, false); }
+
+swarKERNEL int xstrncmpNC(const char * s1, const char * s2, size_t xL) { return xStringCompare(s1, s2, xL ? xL : SIZE_MAX, true); }
+
 int	xstrncmp(const char * s1, const char * s2, size_t xL, bool Exact) {
-	if (xL == 0) {
-		size_t sz1 = strlen(s1);
-		size_t sz2 = strlen(s2);
-		if (sz1 != sz2)
-			return 0;
-		xL = sz1;
-	}
-	IF_myASSERT(debugPARAM, halMemoryANY((void *)s1) && halMemoryANY((void *)s2));
-	while (*s1 && *s2 && xL) {
-		if (Exact == true) {
-			if (*s1 != *s2)
-				break;
-		} else {
-			if (toupper((int)*s1) != toupper((int)*s2))
-				break;
-		}
-		++s1;
-		++s2;
-		--xL;
-	}
-	return (*s1 == 0 && *s2 == 0) ? 1 : (xL == 0) ? 1 : 0;
+	return Exact ? xstrncmpExact(s1, s2, xL) : xstrncmpNC(s1, s2, xL);
 }
 
+swarKERNEL int xstrcmpExact(const char * s1, const char * s2) { return xStringCompare(s1, s2, SIZE_MAX, false); }
+
+swarKERNEL int xstrcmpNC(const char * s1, const char * s2) { return xStringCompare(s1, s2, SIZE_MAX, true); }
+
 int	xstrcmp(const char * s1, const char * s2, bool Exact) {
-	IF_myASSERT(debugPARAM, halMemoryANY((void *)s1) && halMemoryANY((void *)s2));
-	while (*s1 && *s2) {
-		if (Exact) {
-			if (*s1 != *s2)
-				break;
-		} else {
-			if (toupper((int)*s1) != toupper((int)*s2))
-				break;
-		}
-		++s1;
-		++s2;
+	return Exact ? xstrcmpExact(s1, s2) : xstrcmpNC(s1, s2);
+}
+
+int	xstrncmpView(const strv_t * psView, const char * pStr, bool Exact) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)psView) && halMemoryANY((void *)pStr));
+	const char * s1 = psView->pStr;
+	for (size_t xL = psView->Len; xL; --xL, ++s1, ++pStr) {
+		if (*pStr == 0)
+			return 0;									// string shorter than view
+		if (Exact ? (*s1 != *pStr) : (toupper((int)*s1) != toupper((int)*pStr)))
+			return 0;
 	}
-	return (*s1 == 0 && *s2 == 0) ? 1 : 0;
+	return (*pStr == 0) ? 1 : 0;						// string longer than view?
 }
 
 int	xstrindex(char * key, char * array[]) {
@@ -134,6 +291,125 @@ int	xstrindex(char * key, char * array[]) {
 	return erFAILURE;
 }
 
+int	xstrindexView(const strv_t * psKey, char * array[]) {
+	for (int i = 0; array[i]; ++i) {
+		if (xstrncmpView(psKey, array[i], false))
+			return i;									// strings match, return index
+	}
+	return erFAILURE;
+}
+
+int	xStringHashInit(strhash_t * psHash, char * const array[], u16_t * pSeed, u16_t * pSlot) {
+	IF_myASSERT(debugPARAM, halMemorySRAM(psHash) && halMemoryANY((void *)array) && halMemorySRAM(pSeed) && halMemorySRAM(pSlot));
+	int Count = 0;
+	while (array[Count])
+		++Count;
+	IF_myASSERT(debugPARAM, Count < UINT16_MAX);
+	*psHash = (strhash_t) { .papKey = array, .pSeed = pSeed, .pSlot = pSlot,
+							.Count = Count, .Buckets = stringHASH_SEEDS(Count) };
+	if (Count == 0)
+		return erSUCCESS;
+	memset(pSlot, 0xFF, Count * sizeof(u16_t));			// all slots free
+	memset(pSeed, 0, psHash->Buckets * sizeof(u16_t));
+	for (int i = 0; i < Count; ++i)						// seed entry holds bucket size until placed
+		pSeed[xStringHashKey(array[i]) % psHash->Buckets] = (pSeed[xStringHashKey(array[i]) % psHash->Buckets] + 1) | stringHASH_PENDING;
+	// place largest buckets first, while most slots are still free
+	for (int Size = stringHASH_BUCKET_MAX; Size > 0; --Size) {
+		for (int Bkt = 0; Bkt < psHash->Buckets; ++Bkt) {
+			if (pSeed[Bkt] != (Size | stringHASH_PENDING)) {
+				if (Size == stringHASH_BUCKET_MAX && pSeed[Bkt] > (Size | stringHASH_PENDING))
+					return erFAILURE;					// too many in bucket, duplicates?
+				continue;
+			}
+			u16_t Index[stringHASH_BUCKET_MAX];
+			u32_t Hash[stringHASH_BUCKET_MAX];
+			int Num = 0;
+			for (int i = 0; i < Count && Num < Size; ++i) {
+				u32_t Temp = xStringHashKey(array[i]);
+				if ((Temp % psHash->Buckets) == (u32_t) Bkt) {
+					Index[Num] = i;
+					Hash[Num++] = Temp;
+				}
+			}
+			u16_t Seed;
+			for (Seed = 1; Seed < stringHASH_PENDING; ++Seed) {	// find seed placing all in free slots
+				int i;
+				for (i = 0; i < Num; ++i) {
+					u32_t Slot = xStringHashSlot(Hash[i], Seed, Count);
+					if (pSlot[Slot] != UINT16_MAX)
+						break;							// slot taken
+					pSlot[Slot] = Index[i];
+				}
+				if (i == Num)
+					break;								// all placed
+				while (i--)								// undo partial placement
+					pSlot[xStringHashSlot(Hash[i], Seed, Count)] = UINT16_MAX;
+			}
+			if (Seed == stringHASH_PENDING)
+				return erFAILURE;						// no seed, duplicate keywords
+			pSeed[Bkt] = Seed;
+		}
+	}
+	return erSUCCESS;
+}
+
+int	xStringHashIndex(const strhash_t * psHash, const char * pKey) {
+	if (psHash->Count == 0)
+		return erFAILURE;
+	u32_t Hash = xStringHashKey(pKey);
+	u16_t Seed = psHash->pSeed[Hash % psHash->Buckets];
+	if (Seed == 0)
+		return erFAILURE;								// empty bucket
+	u16_t Index = psHash->pSlot[xStringHashSlot(Hash, Seed, psHash->Count)];
+	return (strcasecmp(pKey, psHash->papKey[Index]) == 0) ? Index : erFAILURE;
+}
+
+int	xStringTrieInit(strtrie_t * psTrie, char * const array[], strnode_t * psNode, size_t Size) {
+	IF_myASSERT(debugPARAM, halMemorySRAM(psTrie) && halMemoryANY((void *)array) && halMemorySRAM(psNode) && Size > 0);
+	if (Size > UINT16_MAX)
+		Size = UINT16_MAX;
+	*psTrie = (strtrie_t) { .psNode = psNode, .Size = Size, .Used = 1 };
+	psNode[0] = (strnode_t) { .Chr = 0, .Child = 0, .Next = 0, .Key = -1, .Uniq = -1 };
+	for (int Idx = 0; array[Idx]; ++Idx) {
+		int Node = 0;
+		for (const char * pKey = array[Idx]; *pKey; ++pKey) {
+			psNode[Node].Uniq = (psNode[Node].Uniq == -1) ? Idx : stringTRIE_AMBIGUOUS;
+			char cChr = toupper((int) *pKey);
+			u16_t * pLink = &psNode[Node].Child;		// find child, or position to insert it
+			while (*pLink && psNode[*pLink].Chr < cChr)
+				pLink = &psNode[*pLink].Next;
+			if (*pLink == 0 || psNode[*pLink].Chr != cChr) {
+				if (psTrie->Used == psTrie->Size)
+					return erFAILURE;					// out of nodes
+				int New = psTrie->Used++;
+				psNode[New] = (strnode_t) { .Chr = cChr, .Child = 0, .Next = *pLink, .Key = -1, .Uniq = -1 };
+				*pLink = New;
+			}
+			Node = *pLink;
+		}
+		if (psNode[Node].Key >= 0)
+			return erFAILURE;							// duplicate keyword
+		psNode[Node].Key = Idx;
+		psNode[Node].Uniq = (psNode[Node].Uniq == -1) ? Idx : stringTRIE_AMBIGUOUS;
+	}
+	return erSUCCESS;
+}
+
+int	xStringTrieMatch(const strtrie_t * psTrie, const char * pKey, size_t Len, bool Prefix) {
+	int Node = xStringTrieWalk(psTrie, pKey, Len);
+	if (Node <= 0)
+		return erFAILURE;								// no path, or empty key
+	const strnode_t * psNode = &psTrie->psNode[Node];
+	if (psNode->Key >= 0)
+		return psNode->Key;								// exact match
+	return Prefix ? psNode->Uniq : erFAILURE;			// unique, ambiguous OR none
+}
+
+int	xStringTrieComplete(const strtrie_t * psTrie, const char * pKey, size_t Len, u16_t * pIdx, int Max) {
+	int Node = (Len || *pKey) ? xStringTrieWalk(psTrie, pKey, Len) : 0;
+	return (Node == erFAILURE) ? 0 : xStringTrieCollect(psTrie, Node, pIdx, Max, 0);
+}
+
 int xstrishex(char * pStr) {
 	int iRV = 0;
 	while (*pStr == CHR_SPACE) {						// leading ' '
@@ -151,8 +427,21 @@ int xstrishex(char * pStr) {
 
 // #################################################################################################
 
-int	xStringSkipDelim(char * pSrc, const char * pDel, size_t MaxLen) {
-	IF_myASSERT(debugPARAM, halMemoryANY((void*) pSrc) && halMemoryANY((void *)pDel));
+void vStringDelimSetInit(delim_set_t * psSet, const char * pDel, bool Fold) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)psSet) && halMemoryANY((void *)pDel));
+	memset(psSet, 0, sizeof(delim_set_t));
+	while (*pDel) {
+		u8_t cChr = *pDel++;
+		psSet->Map[cChr >> 5] |= 1UL << (cChr & 0x1F);
+		if (Fold && isalpha(cChr)) {
+			cChr ^= 0x20;								// other case
+			psSet->Map[cChr >> 5] |= 1UL << (cChr & 0x1F);
+		}
+	}
+}
+
+int	xStringSkipDelimSet(char * pSrc, const delim_set_t * psDel, size_t MaxLen) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void*) pSrc) && halMemoryANY((void *)psDel));
 	// If no length supplied
 	if (MaxLen == 0) {
 		MaxLen = xstrnlen(pSrc, stringMAX_LEN);	// assume NULL terminated and calculate length
@@ -161,7 +450,7 @@ int	xStringSkipDelim(char * pSrc, const char * pDel, size_t MaxLen) {
 	IF_PX(debugDELIM, " '%.4s'", pSrc);
 	// continue skipping over valid terminator characters
 	int	CurLen = 0;
-	while (strchr(pDel, *pSrc) && (CurLen < MaxLen)) {
+	while (((size_t) CurLen < MaxLen) && bStringDelimTest(psDel, *pSrc)) {
 		++pSrc;
 		++CurLen;
 	}
@@ -169,7 +458,14 @@ int	xStringSkipDelim(char * pSrc, const char * pDel, size_t MaxLen) {
 	return CurLen;								// number of delimiters skipped over
 }
 
-int xStringCountSpaces(char * pSrc) {
+int	xStringSkipDelim(char * pSrc, const char * pDel, size_t MaxLen) {
+	delim_set_t sDel;
+	vStringDelimSetInit(&sDel, pDel, false);
+	sDel.Map[0] |= 1UL;							// strchr() matches the terminator, retain that
+	return xStringSkipDelimSet(pSrc, &sDel, MaxLen);
+}
+
+int xStringCountSpacesByte(char * pSrc) {
 	int iRV = 0;
 	while (isblank(*pSrc)) {
 		++pSrc;
@@ -178,7 +474,7 @@ int xStringCountSpaces(char * pSrc) {
 	return iRV;
 }
 
-int xStringCountCRLF(char * pSrc) {
+int xStringCountCRLFByte(char * pSrc) {
 	int iRV = 0;
 	while (*pSrc == CHR_CR || *pSrc == CHR_LF) {
 		++pSrc;
@@ -187,20 +483,43 @@ int xStringCountCRLF(char * pSrc) {
 	return iRV;
 }
 
-int	xStringFindDelim(char * pSrc, const char * pDlm, size_t xMax) {
-	IF_myASSERT(debugPARAM, halMemoryANY(pSrc));
+#if (stringSWAR == 1)
+/**
+ * @brief	count leading characters that match either of 2 values, terminating NUL never matches
+ */
+static swarKERNEL int xStringCountPair(char * pSrc, u8_t cChr1, u8_t cChr2) {
+	char * pNow = pSrc;
+	while (!swarALIGNED(pNow)) {						// bytes up to word boundary
+		if (*pNow != cChr1 && *pNow != cChr2)
+			return pNow - pSrc;
+		++pNow;
+	}
+	while (1) {											// aligned words, terminated by NUL latest
+		swar_t Word = *(const swar_t *) pNow;
+		swar_t Miss = ~(xSwarEqual(Word, cChr1) | xSwarEqual(Word, cChr2)) & swarREP(0x80);
+		if (Miss)
+			return (pNow - pSrc) + xSwarFirst(Miss);
+		pNow += swarSIZE;
+	}
+}
+
+int xStringCountSpaces(char * pSrc) { return xStringCountPair(pSrc, CHR_SPACE, CHR_TAB); }
+
+int xStringCountCRLF(char * pSrc) { return xStringCountPair(pSrc, CHR_CR, CHR_LF); }
+#else
+int xStringCountSpaces(char * pSrc) { return xStringCountSpacesByte(pSrc); }
+
+int xStringCountCRLF(char * pSrc) { return xStringCountCRLFByte(pSrc); }
+#endif
+
+int	xStringFindDelimSet(char * pSrc, const delim_set_t * psDlm, size_t xMax) {
+	IF_myASSERT(debugPARAM, halMemoryANY(pSrc) && halMemoryANY((void *)psDlm));
 	int xPos = 0;
 	if (xMax == 0)
 		xMax = strlen(pSrc);
 	while (*pSrc && xMax) {
-		int	xSrc = isupper((int) *pSrc) ? tolower((int) *pSrc) : (int) *pSrc;
-		const char * pTmp = pDlm;
-		while (*pTmp) {
-			int	xDlm = isupper((int) *pTmp) ? tolower((int) *pTmp) : (int) *pTmp;
-			if (xSrc == xDlm)
-				return xPos;
-			++pTmp;
-		}
+		if (bStringDelimTest(psDlm, *pSrc))
+			return xPos;
 		++xPos;
 		++pSrc;
 		--xMax;
@@ -208,10 +527,32 @@ int	xStringFindDelim(char * pSrc, const char * pDlm, size_t xMax) {
 	return erFAILURE;
 }
 
+int	xStringSkipDelimN(const char * pSrc, size_t sSrc, const delim_set_t * psDel) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)pSrc) && halMemoryANY((void *)psDel));
+	const char * pNow = pSrc;
+	for (const char * pEnd = pSrc + sSrc; pNow < pEnd && bStringDelimTest(psDel, *pNow); ++pNow);
+	return pNow - pSrc;
+}
+
+int	xStringFindDelimN(const char * pSrc, size_t sSrc, const delim_set_t * psDlm) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)pSrc) && halMemoryANY((void *)psDlm));
+	for (const char * pNow = pSrc, * pEnd = pSrc + sSrc; pNow < pEnd; ++pNow) {
+		if (bStringDelimTest(psDlm, *pNow))
+			return pNow - pSrc;
+	}
+	return erFAILURE;
+}
+
+int	xStringFindDelim(char * pSrc, const char * pDlm, size_t xMax) {
+	delim_set_t sDlm;
+	vStringDelimSetInit(&sDlm, pDlm, true);		// match ignoring case
+	return xStringFindDelimSet(pSrc, &sDlm, xMax);
+}
+
 // ############################## Bitmap to string decode functions ################################
 
 int	xStringValueMap(const char * pString, char * pBuf, u32_t uValue, int iWidth) {
-	IF_myASSERT(debugPARAM, halMemoryANY((void*) pString) && halMemorySRAM((void*) pBuf) && (iWidth <= 32) && (strnlen(pString, 33) <= iWidth));
+	IF_myASSERT(debugPARAM, halMemoryANY((void*) pString) && halMemorySRAM((void*) pBuf) && (iWidth <= 32) && (strnlen(pString, 33) <= (size_t) iWidth));
 	u32_t uMask = 0x8000 >> (32 - iWidth);
 	int Idx;
 	for (Idx = 0; Idx < iWidth; ++Idx, ++pString, ++pBuf, uMask >>= 1)
@@ -219,3 +560,46 @@ int	xStringValueMap(const char * pString, char * pBuf, u32_t uValue, int iWidth)
 	*pBuf = 0;
 	return Idx;
 }
+
+// ################################## Function timing statistics ###################################
+
+static strtime_t * psTimingList = NULL;
+
+void vStringTimingRecord(strtime_t * psStat, u32_t Cycles, size_t Bytes) {
+	if (__atomic_load_n(&psStat->Linked, __ATOMIC_ACQUIRE) == false &&
+		__atomic_exchange_n(&psStat->Linked, true, __ATOMIC_ACQ_REL) == false) {	// 1st call, this core registers
+		strtime_t * psHead = __atomic_load_n(&psTimingList, __ATOMIC_RELAXED);
+		do {
+			psStat->psNext = psHead;
+		} while (__atomic_compare_exchange_n(&psTimingList, &psHead, psStat, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) == false);
+	}
+	++psStat->Count;
+	psStat->Bytes += Bytes;
+	psStat->Cycles += Cycles;
+	++psStat->Hist[Cycles ? 31 - __builtin_clz(Cycles) : 0];
+}
+
+void vStringTimingReport(void) {
+	for (strtime_t * psStat = __atomic_load_n(&psTimingList, __ATOMIC_ACQUIRE); psStat; psStat = psStat->psNext) {
+		if (psStat->Count == 0)
+			continue;
+		PX("%-28s n=%'lu  B=%'llu  cyc/call=%'llu  cyc/B=%llu.%02llu" strNL, psStat->pcName, (unsigned long) psStat->Count,
+			(unsigned long long) psStat->Bytes, (unsigned long long) (psStat->Cycles / psStat->Count),
+			(unsigned long long) (psStat->Bytes ? psStat->Cycles / psStat->Bytes : 0),
+			(unsigned long long) (psStat->Bytes ? ((psStat->Cycles * 100) / psStat->Bytes) % 100 : 0));
+		PX("  log2(cyc):");
+		for (int Bin = 0; Bin < stringTIMING_BINS; ++Bin) {
+			if (psStat->Hist[Bin])
+				PX(" %d=%lu", Bin, (unsigned long) psStat->Hist[Bin]);
+		}
+		PX(strNL);
+	}
+}
+
+void vStringTimingReset(void) {
+	for (strtime_t * psStat = __atomic_load_n(&psTimingList, __ATOMIC_ACQUIRE); psStat; psStat = psStat->psNext) {
+		psStat->Count = 0;
+		psStat->Bytes = psStat->Cycles = 0;
+		memset(psStat->Hist, 0, sizeof(psStat->Hist));
+	}
+}
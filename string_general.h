@@ -16,6 +16,36 @@ extern "C" {
 // ########################################### MACROS ##############################################
 
 #define stringXMEMREV_XOR           0
+#define	stringSWAR					1			// 1 = word-at-a-time kernels, 0 = byte loops
+
+// ################################## Compiled delimiter sets ######################################
+
+/* Build a delimiter set from up to 8 character constants at compile time, eg
+ * 		static const delim_set_t sDelim = delimSET(' ', ',', ';');
+ * delimSET_NC() adds the other case of each alpha character for case insensitive matching.
+ * NUL is never a member, it is always handled explicitly by the scanning functions. */
+#define	delimBIT(w,c)				((((u8_t)(c) >> 5) == (w)) ? (1UL << ((u8_t)(c) & 0x1F)) : 0UL)
+#define	delimFOLD(c)				(INRANGE('A', (c), 'Z') ? ((c) | 0x20) : INRANGE('a', (c), 'z') ? ((c) & ~0x20) : (c))
+#define	delimWORD(w,a,b,c,d,e,f,g,h)	(delimBIT(w,a) | delimBIT(w,b) | delimBIT(w,c) | delimBIT(w,d) | \
+									 delimBIT(w,e) | delimBIT(w,f) | delimBIT(w,g) | delimBIT(w,h))
+#define	delimWORD_NC(w,a,b,c,d,e,f,g,h)	(delimWORD(w,a,b,c,d,e,f,g,h) | delimWORD(w,delimFOLD(a),delimFOLD(b), \
+									 delimFOLD(c),delimFOLD(d),delimFOLD(e),delimFOLD(f),delimFOLD(g),delimFOLD(h)))
+#define	delimMAP(W,a,b,c,d,e,f,g,h,...)	{ .Map = { W(0,a,b,c,d,e,f,g,h) & ~1UL, W(1,a,b,c,d,e,f,g,h), \
+									W(2,a,b,c,d,e,f,g,h), W(3,a,b,c,d,e,f,g,h), W(4,a,b,c,d,e,f,g,h), \
+									W(5,a,b,c,d,e,f,g,h), W(6,a,b,c,d,e,f,g,h), W(7,a,b,c,d,e,f,g,h) } }
+#define	delimSET(...)				delimMAP(delimWORD, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0)
+#define	delimSET_NC(...)			delimMAP(delimWORD_NC, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0)
+
+// ################################### Keyword perfect hash ########################################
+
+#define	stringHASH_SEEDS(n)			(((n) + 1) / 2)	// seed entries required for n keywords
+#define	stringHASH_BUCKET_MAX		16				// max keywords sharing a seed bucket
+#define	stringHASH_PENDING			0x8000			// seed entry flag during build, bucket not yet placed
+
+// ################################### Keyword prefix trie #########################################
+
+#define	stringTRIE_NODES(c)			((c) + 1)		// nodes required for keywords totalling c chars
+#define	stringTRIE_AMBIGUOUS		-2				// prefix matches more than 1 keyword
 
 // ############################## Used for String <> DATETIME conversions ##########################
 
@@ -33,6 +63,63 @@ extern "C" {
 #define	DATETIME_HMS_MASK			(DATETIME_HOUR_OK | DATETIME_MIN_OK | DATETIME_SEC_OK)
 #define	DATETIME_YMDHMS_MASK		(DATETIME_YMD_MASK | DATETIME_HMS_MASK)
 
+// ######################################### Structures ############################################
+
+/**
+ * @brief	256 bit character class bitmap, one bit per possible character value
+ */
+typedef struct delim_set_t {
+	u32_t Map[8];
+} delim_set_t;
+
+/**
+ * @brief	non-owning view (slice) of a string, NOT necessarily terminated
+ */
+typedef struct strv_t {
+	char * pStr;
+	size_t Len;
+} strv_t;
+
+/**
+ * @brief	case insensitive minimal perfect hash over a fixed NULL terminated keyword table
+ * @note	all arrays are flat and read-only once built, suitable for const/flash placement
+ */
+typedef struct strhash_t {
+	char * const * papKey;								// keyword table as used by xstrindex()
+	u16_t * pSeed;										// [stringHASH_SEEDS(Count)] bucket seeds
+	u16_t * pSlot;										// [Count] slot -> keyword index
+	u16_t Count;										// number of keywords
+	u16_t Buckets;										// number of seed buckets
+} strhash_t;
+
+/**
+ * @brief	prefix trie node, siblings linked in ascending (upper case) character order
+ */
+typedef struct strnode_t {
+	char Chr;											// upper case character of this edge
+	u16_t Child;										// 1st child node, 0 if none
+	u16_t Next;											// next sibling node, 0 if none
+	i16_t Key;											// keyword ending at this node, -1 if none
+	i16_t Uniq;											// only keyword at/below this node, -1 none, stringTRIE_AMBIGUOUS
+} strnode_t;
+
+/**
+ * @brief	case insensitive prefix trie over a fixed NULL terminated keyword table, flat node array
+ */
+typedef struct strtrie_t {
+	strnode_t * psNode;									// node array, [0] is the root
+	u16_t Size;											// number of nodes available
+	u16_t Used;											// number of nodes used
+} strtrie_t;
+
+/**
+ * @brief	field location, relative to the start of the line, as filled by xStringSplitFields()
+ */
+typedef struct strf_t {
+	u16_t Ofs;
+	u16_t Len;
+} strf_t;
+
 // ##################################### string operations #########################################
 
 /**
@@ -80,20 +167,41 @@ void xstrrev(char * pStr);
  /**
  * @brief	based on flag case in/sensitive
  * @param	s1/2 - pointers to strings to be compared
- * @param	xLen - maximum length to compare (non null terminated string)
- * @param	flag - true for exact match, else upper/lower case difference ignored
+ * @param	xLen - maximum length to compare (non null terminated string), 0 to compare full strings
+ * @param	flag - true for exact match, else upper/lower (ASCII) case difference ignored
  * @return			true or false based on comparison
  */
 int xstrncmp(const char * s1, const char * s2, size_t xLen, bool Exact);
 
+/**
+ * @brief	as xstrncmp() with Exact true/false, no per character test of the flag
+ */
+int	xstrncmpExact(const char * s1, const char * s2, size_t xLen);
+int	xstrncmpNC(const char * s1, const char * s2, size_t xLen);
+
 /**
  * @brief	compare two strings based on flag case in/sensitive
  * @param	s1, s2 - pointers to strings to be compared
- * 			flag - true for exact match, else upper/lower case difference ignored
+ * 			flag - true for exact match, else upper/lower (ASCII) case difference ignored
  * @return	true or false based on comparison
  */
 int	xstrcmp(const char * s1, const char * s2, bool Exact);
 
+/**
+ * @brief	as xstrcmp() with Exact true/false, no per character test of the flag
+ */
+int	xstrcmpExact(const char * s1, const char * s2);
+int	xstrcmpNC(const char * s1, const char * s2);
+
+/**
+ * @brief	compare a string view with a terminated string, full length match required
+ * @param	psView - pointer to view to be compared
+ * @param	pStr - pointer to terminated string
+ * @param	Exact - true for exact match, else upper/lower case difference ignored
+ * @return	1 if view and string are the same length and match, else 0
+ */
+int	xstrncmpView(const strv_t * psView, const char * pStr, bool Exact);
+
 /**
  * @brief	determine array index of specified string in specified string array
  * 			expects the array to be null terminated
@@ -104,6 +212,57 @@ int	xstrcmp(const char * s1, const char * s2, bool Exact);
  */
 int	xstrindex(char *, char * *);
 
+/**
+ * @brief	Same as xstrindex() but key specified as a string view
+ */
+int	xstrindexView(const strv_t * psKey, char * array[]);
+
+/**
+ * @brief	build a minimal perfect hash for a fixed keyword table, typically once at startup
+ * @param[out]	psHash - pointer to hash structure to be initialised
+ * @param[in]	array - NULL terminated table of keywords, as for xstrindex()
+ * @param[in]	pSeed - pointer to stringHASH_SEEDS(count) entries for bucket seeds
+ * @param[in]	pSlot - pointer to count entries for slot to index mapping
+ * @return		erSUCCESS or erFAILURE if table has duplicate (ignoring case) keywords or more than
+ * 				stringHASH_BUCKET_MAX keywords hash to the same seed bucket
+ */
+int	xStringHashInit(strhash_t * psHash, char * const array[], u16_t * pSeed, u16_t * pSlot);
+
+/**
+ * @brief	Same result as xstrindex() for the table used to build the hash, with 1 hash and 1 compare
+ * @return	if match found, index into array else erFAILURE
+ */
+int	xStringHashIndex(const strhash_t * psHash, const char * pKey);
+
+/**
+ * @brief	build a prefix trie for a fixed keyword table, typically once at startup
+ * @param[out]	psTrie - pointer to trie structure to be initialised
+ * @param[in]	array - NULL terminated table of keywords, as for xstrindex()
+ * @param[in]	psNode - pointer to node array, stringTRIE_NODES(total keyword chars) entries sufficient
+ * @param[in]	Size - number of entries in node array
+ * @return		erSUCCESS or erFAILURE if node array too small or duplicate (ignoring case) keywords
+ */
+int	xStringTrieInit(strtrie_t * psTrie, char * const array[], strnode_t * psNode, size_t Size);
+
+/**
+ * @brief	find keyword by exact or unique abbreviation match, time proportional to key length
+ * @param[in]	pKey - pointer to key, need not be terminated if Len specified
+ * @param[in]	Len - length of key, 0 if terminated
+ * @param[in]	Prefix - true to accept a unique abbreviation, exact match always preferred
+ * @return		index into keyword array, erFAILURE if no match or stringTRIE_AMBIGUOUS
+ */
+int	xStringTrieMatch(const strtrie_t * psTrie, const char * pKey, size_t Len, bool Prefix);
+
+/**
+ * @brief	list the keywords starting with the specified prefix, in ascending order
+ * @param[in]	pKey - pointer to prefix, need not be terminated if Len specified
+ * @param[in]	Len - length of prefix, 0 if terminated
+ * @param[out]	pIdx - pointer to array where keyword indexes are returned
+ * @param[in]	Max - number of entries in pIdx
+ * @return		number of completions found, only the first Max are returned
+ */
+int	xStringTrieComplete(const strtrie_t * psTrie, const char * pKey, size_t Len, u16_t * pIdx, int Max);
+
 /**
  * @brief
  * @param[in]
@@ -131,8 +290,52 @@ int	xStringParseUnicode(char * pDst, char * pSrc, size_t sDst);
 int	xStringSkipDelim(char * pSrc, const char * pDel, size_t sDst);
 int xStringCountSpaces(char * pSrc);
 int xStringCountCRLF(char * pSrc);
+
+/**
+ * @brief	byte-at-a-time reference versions of the word-at-a-time kernels above,
+ * 			used when stringSWAR is disabled and for verification/benchmarking
+ */
+size_t xstrnlenByte(const char * pStr, size_t uMax);
+int	xstrncpyByte(char * pDst, char * pSrc, int xLen);
+int xStringCountSpacesByte(char * pSrc);
+int xStringCountCRLFByte(char * pSrc);
 int	xStringFindDelim(char * pSrc, const char * pDlm, size_t xMax);
 
+/**
+ * @brief	build a delimiter set at run time from a string of delimiters
+ * @param[out]	psSet - pointer to set to be initialised
+ * @param[in]	pDel - pointer to string of delimiters
+ * @param[in]	Fold - true to add both upper and lower case of alpha delimiters
+ */
+void vStringDelimSetInit(delim_set_t * psSet, const char * pDel, bool Fold);
+
+/**
+ * @brief	test if character is a member of the delimiter set
+ */
+static inline bool bStringDelimTest(const delim_set_t * psSet, int iChr) {
+	return (psSet->Map[(u8_t) iChr >> 5] >> ((u8_t) iChr & 0x1F)) & 1UL;
+}
+
+/**
+ * @brief	Same as xStringSkipDelim() but using a precompiled delimiter set, NUL only skipped if in set
+ */
+int	xStringSkipDelimSet(char * pSrc, const delim_set_t * psDel, size_t MaxLen);
+
+/**
+ * @brief	Same as xStringFindDelim() but using a precompiled delimiter set
+ * @note	case folding, if required, must be built into the set (delimSET_NC() or Fold = true)
+ */
+int	xStringFindDelimSet(char * pSrc, const delim_set_t * psDlm, size_t xMax);
+
+/**
+ * @brief	length carrying variants for buffers of known size, need not be terminated
+ * @note	exactly sSrc characters examined, NUL never scanned for and only matched if in set
+ * @return	SkipDelimN: number of leading delimiters skipped, 0 -> sSrc
+ * 			FindDelimN: index of first delimiter, erFAILURE if none within sSrc
+ */
+int	xStringSkipDelimN(const char * pSrc, size_t sSrc, const delim_set_t * psDel);
+int	xStringFindDelimN(const char * pSrc, size_t sSrc, const delim_set_t * psDlm);
+
 /**
  * @brief	Copies token from source buffer to destination buffer
  * @param	pDst - pointer to destination buffer
@@ -144,6 +347,25 @@ int	xStringFindDelim(char * pSrc, const char * pDlm, size_t xMax);
  */
 char * pcStringParseToken(char * pDst, char * pSrc, const char * pDel, int flag, size_t sDst);
 
+/**
+ * @brief	Same as pcStringParseToken() but using a precompiled delimiter set
+ */
+char * pcStringParseTokenSet(char * pDst, char * pSrc, const delim_set_t * psDel, int flag, size_t sDst);
+
+/**
+ * @brief	Locate (no copy) next token in source buffer, same leading space and delimiter handling as pcStringParseToken()
+ * @param	psTok - pointer to view to be set to the token, length 0 if no token
+ * @param	pSrc - pointer to source buffer
+ * @param	pDel - pointer to possible delimiters terminating the token
+ * @return	pointer to next character to be processed...
+ */
+char * pcStringParseTokenView(strv_t * psTok, char * pSrc, const char * pDel);
+
+/**
+ * @brief	Same as pcStringParseTokenView() but using a precompiled delimiter set
+ */
+char * pcStringParseTokenViewSet(strv_t * psTok, char * pSrc, const delim_set_t * psDel);
+
 /**
  * pcStringParseDateTime()
  * @brief		parse a string with format	2015-04-01T12:34:56.789Z
@@ -159,7 +381,7 @@ char * pcStringParseToken(char * pDst, char * pSrc, const char * pDel, int flag,
  * 				valid values (if found) in time structure
  * 				0 if no valid milli/second values found
  * @note		tm_isdst not yet calculated/set!!
- * 				Must also add support for following 3 formats as used
+ * 				Also supports the following 3 formats as used
  * 				in HTTP1.1 onwards for "If-Modified-Since" option
  * 					Fri, 31 Dec 1999 23:59:59 GMT (standard going forward)
  *					Friday, 31-Dec-99 23:59:59 GMT
@@ -178,6 +400,17 @@ char * pcStringParseDateTime(char * buf, u64_t * pTStamp, tm_t * psTM);
  */
 int	xStringValueMap(const char * pString, char * pBuf, u32_t uValue, int iWidth);
 
+/**
+ * @brief	report call count, bytes, cycles and log2 cycle histogram for each instrumented function
+ * @note	only functions in source files built with debugTIMING enabled, and called, are listed
+ */
+void vStringTimingReport(void);
+
+/**
+ * @brief	clear the statistics of all instrumented functions
+ */
+void vStringTimingReset(void);
+
 void  x_string_general_test(void);
 
 #ifdef __cplusplus
@@ -5,7 +5,10 @@
 #include "printfx.h"
 #include "errors_events.h"
 #include "string_general.h"
+#include "string_parse.h"
 #include "string_to_values.h"
+#include "values_to_string.h"
+#include "string_swar.h"
 #include "common-vars.h"
 
 #include <string.h>
@@ -13,7 +16,7 @@
 
 // ########################################### Macros ##############################################
 
-#define	debugFLAG					0xF000
+#define	debugFLAG					0xE000
 #define	debugPARSE_ENCODED			(debugFLAG & 0x0100)
 #define	debugDELIM					(debugFLAG & 0x0200)
 #define	debugTIMING					(debugFLAG_GLOBAL & debugFLAG & 0x1000)
@@ -25,22 +28,31 @@
 	#define	stringMAX_LEN			2048
 #endif
 
-#define	delimDATE1	"-/"
-#define	delimDATE2	"t "
-#define	delimTIME1	"h:"
-#define	delimTIME2	"m:"
-#define	delimTIME3	"sz. "
+#include "string_timing.h"								// after debugTIMING
+
+#define	nameKEY(a,b,c)				((u32_t) (a) | ((u32_t) (b) << 8) | ((u32_t) (c) << 16))	// lower case
+
+// ######################################## Local variables ########################################
+
+static const delim_set_t delimDATE1 = delimSET('-', '/');
+static const delim_set_t delimDATE2 = delimSET_NC('t', ' ');
+static const delim_set_t delimTIME1 = delimSET_NC('h', ':');
+static const delim_set_t delimTIME2 = delimSET_NC('m', ':');
+static const delim_set_t delimTIME3 = delimSET_NC('s', 'z', '.', ' ');
+static const delim_set_t delimUSEC1 = delimSET_NC('.', 's');
+static const delim_set_t delimUSEC2 = delimSET_NC('z', ' ');
 
 // ########################################## Parse support ########################################
 
 int	xStringParseUnicode(char * pDst, char * pSrc, size_t Len) {
+	stringTIMING_START("xStringParseUnicode", pSrc);
 	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pSrc));
 	IF_myASSERT(debugPARAM && (pDst != NULL), halMemorySRAM((void*) pDst));
 	int iRV = 0;
 	if (pDst == NULL)
 		pDst = pSrc;
 	IF_PX(debugPARSE_ENCODED, "%s  ", pSrc);
-	while(*pSrc != 0 && (iRV < Len)) {
+	while(*pSrc != 0 && ((size_t) iRV < Len)) {
 		if (*pSrc == CHR_BACKSLASH && *(pSrc+1) == CHR_u) {		// escape chars?
 			int Val = 0;
 			for (int i = 2; i < 6; ++i) {
@@ -63,74 +75,312 @@ int	xStringParseUnicode(char * pDst, char * pSrc, size_t Len) {
 		}
 		++iRV;											// & adjust count...
 	}
-	if (iRV < Len)
+	if ((size_t) iRV < Len)
 		*pDst = 0;
 	IF_PX(debugPARSE_ENCODED, "%.*s" strNL, iRV, pDst-iRV);
+	stringTIMING_END(pSrc);
 	return iRV;
 }
 
-int	xStringParseEncoded(char * pDst, char * pSrc) {
-	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pSrc));
+/**
+ * @brief	find next JSON string special character ('"', '\\' or NUL), a word at a time
+ */
+static char * pcStringFindJSON(char * pSrc) {
+	while (!swarALIGNED(pSrc)) {						// bytes up to word boundary
+		if (*pSrc == 0 || *pSrc == CHR_DOUBLE_QUOTE || *pSrc == CHR_BACKSLASH)
+			return pSrc;
+		++pSrc;
+	}
+	while (1) {											// aligned words, terminated by NUL latest
+		swar_t Word = *(const swar_t *) pSrc;
+		swar_t Mask = xSwarZero(Word) | xSwarEqual(Word, CHR_DOUBLE_QUOTE) | xSwarEqual(Word, CHR_BACKSLASH);
+		if (Mask)
+			return pSrc + xSwarFirst(Mask);
+		pSrc += swarSIZE;
+	}
+}
+
+/**
+ * @brief	convert exactly 4 hex characters to a value
+ * @return	0x0000 -> 0xFFFF or erFAILURE if any character not a hex digit
+ */
+static int xStringParseHex4(const char * pSrc) {
+	int xVal = 0;
+	for (int i = 0; i < 4; ++i) {
+		if (!isxdigit((int) pSrc[i]))
+			return erFAILURE;
+		xVal = (xVal << 4) | xHexCharToValue(pSrc[i], BASE16);
+	}
+	return xVal;
+}
+
+int	xStringParseJSON(char * pDst, char * pSrc, size_t sDst, char ** ppEnd) {
+	stringTIMING_START("xStringParseJSON", pSrc);
+	IF_myASSERT(debugPARAM, halMemoryANY((void*) pSrc));
 	IF_myASSERT(debugPARAM && (pDst != NULL), halMemorySRAM((void*) pDst));
-	int iRV = 0;
 	if (pDst == NULL)
 		pDst = pSrc;
-	IF_PX(debugPARSE_ENCODED, "%s  ", pSrc);
-	while(*pSrc != 0) {
-		if (*pSrc == CHR_PERCENT) {						// escape char?
-			int Val1 = xHexCharToValue(*++pSrc, BASE16);	// yes, parse 1st value
-			if (Val1 == erFAILURE)
-				return erFAILURE;
-			int Val2 = xHexCharToValue(*++pSrc, BASE16);	// parse 2nd value
-			if (Val2 == erFAILURE)
-				return erFAILURE;
-			IF_PX(debugPARSE_ENCODED, "[%d+%d=%d]  ", Val1, Val2, (Val1 << 4) + Val2);
-			*pDst++ = (Val1 << 4) + Val2;				// calc & store final value
-			++pSrc;									// step to next char
+	char * pOut = pDst;
+	int iRV = erFAILURE;
+	while (1) {
+		char * pTmp = pcStringFindJSON(pSrc);
+		size_t Len = pTmp - pSrc;
+		if (Len > (sDst - (pOut - pDst)))
+			break;										// no space for clean run
+		memmove(pOut, pSrc, Len);						// copy clean run as block
+		pOut += Len;
+		pSrc = pTmp;
+		if (*pSrc != CHR_BACKSLASH) {					// closing '"' or NUL, all done
+			iRV = pOut - pDst;
+			if ((size_t) iRV < sDst)
+				*pOut = 0;
+			break;
+		}
+		u32_t Code;
+		char cEsc = pSrc[1];
+		pSrc += 2;
+		switch (cEsc) {
+		case CHR_DOUBLE_QUOTE:
+		case CHR_BACKSLASH:
+		case CHR_FWDSLASH:	Code = cEsc; break;
+		case CHR_b:			Code = '\b'; break;
+		case CHR_f:			Code = '\f'; break;
+		case CHR_n:			Code = '\n'; break;
+		case CHR_r:			Code = '\r'; break;
+		case CHR_t:			Code = '\t'; break;
+		case CHR_u: {
+			int xVal = xStringParseHex4(pSrc);
+			if (xVal == erFAILURE || INRANGE(0xDC00, xVal, 0xDFFF))
+				return erFAILURE;						// invalid OR lone low surrogate
+			pSrc += 4;
+			Code = xVal;
+			if (INRANGE(0xD800, Code, 0xDBFF)) {		// high surrogate, low must follow
+				if (pSrc[0] != CHR_BACKSLASH || pSrc[1] != CHR_u)
+					return erFAILURE;
+				xVal = xStringParseHex4(pSrc + 2);
+				if (xVal == erFAILURE || OUTSIDE(0xDC00, xVal, 0xDFFF))
+					return erFAILURE;
+				pSrc += 6;
+				Code = 0x10000 + ((Code - 0xD800) << 10) + (xVal - 0xDC00);
+			}
+			break;
+		}
+		default:
+			return erFAILURE;							// illegal escape, incl NUL
+		}
+		// encode as UTF-8, never longer than the escape sequence so in place is safe
+		size_t Size = (Code < 0x80) ? 1 : (Code < 0x800) ? 2 : (Code < 0x10000) ? 3 : 4;
+		if (Size > (sDst - (pOut - pDst)))
+			break;
+		switch (Size) {
+		case 1:	*pOut++ = Code; break;
+		case 2:	*pOut++ = 0xC0 | (Code >> 6); break;
+		case 3:	*pOut++ = 0xE0 | (Code >> 12); break;
+		case 4:	*pOut++ = 0xF0 | (Code >> 18);
+				*pOut++ = 0x80 | ((Code >> 12) & 0x3F); break;
+		}
+		if (Size > 2)
+			*pOut++ = 0x80 | ((Code >> 6) & 0x3F);
+		if (Size > 1)
+			*pOut++ = 0x80 | (Code & 0x3F);
+	}
+	stringTIMING_END(pSrc);
+	if (ppEnd)
+		*ppEnd = pSrc;
+	IF_PX(debugPARSE_ENCODED && iRV > 0, "%.*s" strNL, iRV, pDst);
+	return iRV;
+}
+
+void vStringParseEncodedInit(enc_ctx_t * psCtx, bool Plus) {
+	psCtx->State = 0;
+	psCtx->Nibble = 0;
+	psCtx->Plus = Plus;
+}
+
+int	xStringParseEncodedChunk(enc_ctx_t * psCtx, char * pDst, size_t sDst, const char * pSrc, size_t sSrc, size_t * pUsed) {
+	stringTIMING_START("xStringParseEncodedChunk", pSrc);
+	IF_myASSERT(debugPARAM, halMemorySRAM((void*) psCtx) && halMemorySRAM((void*) pDst) && halMemoryANY((void*) pSrc));
+	const char * pBeg = pSrc, * pEnd = pSrc + sSrc;
+	char * pOut = pDst, * pLim = pDst + sDst;
+	while (pSrc < pEnd) {
+		if (psCtx->State == 0) {
+			if (psCtx->Plus == false) {					// copy run up to next escape as block
+				const char * pEsc = memchr(pSrc, CHR_PERCENT, pEnd - pSrc);
+				size_t Len = (pEsc ? pEsc : pEnd) - pSrc;
+				if (Len > (size_t) (pLim - pOut))
+					Len = pLim - pOut;
+				memmove(pOut, pSrc, Len);
+				pOut += Len;
+				pSrc += Len;
+				if (pSrc == pEnd || *pSrc != CHR_PERCENT)
+					break;								// all done OR output full
+			}
+			if (*pSrc == CHR_PERCENT) {					// escape char?
+				psCtx->State = 1;
+			} else {
+				if (pOut == pLim)
+					break;								// output full
+				*pOut++ = (*pSrc == CHR_PLUS) ? CHR_SPACE : *pSrc;
+			}
 		} else {
-			*pDst++ = *pSrc++;							// copy as is to (new) position
+			int xVal = xHexCharToValue(*pSrc, BASE16);
+			if (xVal == erFAILURE)
+				return erFAILURE;
+			if (psCtx->State == 1) {					// 1st nibble, save
+				psCtx->Nibble = xVal;
+				psCtx->State = 2;
+			} else {									// 2nd nibble, store if space
+				if (pOut == pLim)
+					break;								// output full, reprocess 2nd nibble next call
+				IF_PX(debugPARSE_ENCODED, "[%d+%d=%d]  ", psCtx->Nibble, xVal, (psCtx->Nibble << 4) + xVal);
+				*pOut++ = (psCtx->Nibble << 4) + xVal;	// calc & store final value
+				psCtx->State = 0;
+			}
 		}
-		++iRV;											// & adjust count...
+		++pSrc;
 	}
-	*pDst = 0;
-	IF_PX(debugPARSE_ENCODED, "%s" strNL, pSrc-iRV);
+	stringTIMING_END(pSrc);
+	if (pUsed)
+		*pUsed = pSrc - pBeg;
+	return pOut - pDst;
+}
+
+int	xStringParseEncodedDone(enc_ctx_t * psCtx) { return (psCtx->State == 0) ? erSUCCESS : erFAILURE; }
+
+int	xStringParseEncoded(char * pDst, char * pSrc) {
+	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pSrc));
+	IF_myASSERT(debugPARAM && (pDst != NULL), halMemorySRAM((void*) pDst));
+	if (pDst == NULL)
+		pDst = pSrc;
+	IF_PX(debugPARSE_ENCODED, "%s  ", pSrc);
+	enc_ctx_t sCtx;
+	vStringParseEncodedInit(&sCtx, false);
+	size_t Len = strlen(pSrc);							// decoded length never more than encoded
+	int iRV = xStringParseEncodedChunk(&sCtx, pDst, Len, pSrc, Len, NULL);
+	if (iRV == erFAILURE || xStringParseEncodedDone(&sCtx) == erFAILURE)
+		return erFAILURE;
+	pDst[iRV] = 0;
+	IF_PX(debugPARSE_ENCODED, "%s" strNL, pDst);
 	return iRV;
 }
 
-char * pcStringParseToken(char * pDst, char * pSrc, const char * pDel, int flag, size_t sDst) {
+char * pcStringParseTokenSet(char * pDst, char * pSrc, const delim_set_t * psDel, int flag, size_t sDst) {
+	stringTIMING_START("pcStringParseTokenSet", pSrc);
 	pSrc += xStringCountSpaces(pSrc);					// skip over leading "spaces"
 	char * pTmp = pDst;
 	do {
-		if (*pSrc == 0 || strchr(pDel, *pSrc))			// end of string OR delimiter?
+		if (*pSrc == 0 || bStringDelimTest(psDel, *pSrc))	// end of string OR delimiter?
 			break;
 		*pTmp = (flag < 0) ? tolower((int)*pSrc) : (flag > 0) ? toupper((int)*pSrc) : *pSrc;
 		++pTmp;
 		++pSrc;
 	} while (--sDst > 1);			// leave space for terminator
 	*pTmp = 0;
+	stringTIMING_END(pSrc);
+	return pSrc;					// pointer to NULL or next char [delimiter?] to be processed..
+}
+
+char * pcStringParseToken(char * pDst, char * pSrc, const char * pDel, int flag, size_t sDst) {
+	delim_set_t sDel;
+	vStringDelimSetInit(&sDel, pDel, false);
+	return pcStringParseTokenSet(pDst, pSrc, &sDel, flag, sDst);
+}
+
+char * pcStringParseTokenViewSet(strv_t * psTok, char * pSrc, const delim_set_t * psDel) {
+	stringTIMING_START("pcStringParseTokenViewSet", pSrc);
+	pSrc += xStringCountSpaces(pSrc);					// skip over leading "spaces"
+	psTok->pStr = pSrc;
+	while (*pSrc && !bStringDelimTest(psDel, *pSrc))	// up to end of string OR delimiter
+		++pSrc;
+	psTok->Len = pSrc - psTok->pStr;
+	stringTIMING_END(pSrc);
 	return pSrc;					// pointer to NULL or next char [delimiter?] to be processed..
 }
 
+char * pcStringParseTokenView(strv_t * psTok, char * pSrc, const char * pDel) {
+	delim_set_t sDel;
+	vStringDelimSetInit(&sDel, pDel, false);
+	return pcStringParseTokenViewSet(psTok, pSrc, &sDel);
+}
+
+int	xStringSplitFields(const char * pSrc, size_t sSrc, const delim_set_t * psDel, int Flags, strf_t * psFld, int Max) {
+	stringTIMING_START("xStringSplitFields", pSrc);
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)pSrc) && halMemoryANY((void *)psDel) && halMemorySRAM(psFld) && Max > 0);
+	if (sSrc == 0)
+		sSrc = stringMAX_LEN;							// terminated, NUL will end the scan
+	IF_myASSERT(debugPARAM, sSrc <= UINT16_MAX);
+	int Count = 0;
+	size_t Ofs, Beg = 0;
+	for (Ofs = 0; Ofs < sSrc && pSrc[Ofs]; ++Ofs) {
+		if (!bStringDelimTest(psDel, pSrc[Ofs]))
+			continue;
+		if (Ofs > Beg || (Flags & stringSPLIT_COLLAPSE) == 0) {
+			if (Count == (Max - 1))
+				break;									// last entry, takes the remainder
+			psFld[Count].Ofs = Beg;
+			psFld[Count++].Len = Ofs - Beg;
+		}
+		Beg = Ofs + 1;
+	}
+	while (Ofs < sSrc && pSrc[Ofs])						// if array full, find end of line
+		++Ofs;
+	if ((Ofs > Beg) || (Ofs > 0 && (Flags & stringSPLIT_COLLAPSE) == 0)) {
+		psFld[Count].Ofs = Beg;
+		psFld[Count++].Len = Ofs - Beg;
+	}
+	stringTIMING_BYTES(Ofs);
+	return Count;
+}
+
+char * cvParseValueView(const strv_t * psView, cvi_e cvI, px_t pX) {
+	if (cvI < cvF32) {									// integer, parse directly within view
+		x64_t X64;
+		char * pTmp = pcStringParseIntegerN(psView->pStr, psView->Len, cvI, &X64);
+		if (pTmp != pcFAILURE)
+			vx64ValueStore(X64, pX, cvI);
+		return pTmp;
+	}
+	char caBuf[48];										// other types need a terminated copy
+	if (psView->Len >= sizeof(caBuf))
+		return pcFAILURE;
+	memcpy(caBuf, psView->pStr, psView->Len);
+	caBuf[psView->Len] = 0;
+	char * pTmp = cvParseValue(caBuf, cvI, pX);
+	return (pTmp == pcFAILURE) ? pTmp : psView->pStr + (pTmp - caBuf);
+}
+
 char * cvParseValue(char * pSrc, cvi_e cvI, px_t pX) {
+	stringTIMING_START("cvParseValue", pSrc);
+	if (cvI < cvF32) {									// integer, parse directly
+		x64_t X64;
+		char * pTmp = pcStringParseInteger(pSrc, cvI, &X64);
+		IF_PX(debugTRACK & (pTmp == pcFAILURE), "~[Err %.8s]", pSrc);
+		if (pTmp != pcFAILURE)
+			vx64ValueStore(X64, pX, cvI);
+		stringTIMING_END(pTmp);
+		return pTmp;
+	}
+	if (cvI <= cvF64) {									// float, no scanf
+		char * pTmp = pcStringParseFloat(pSrc, cvI, pX);
+		IF_PX(debugTRACK & (pTmp == pcFAILURE), "~[Err %.8s]", pSrc);
+		stringTIMING_END(pTmp);
+		return pTmp;
+	}
 	int Len = 0;
 	char caBuf[16]; caBuf[0] = CHR_SPACE;
 	strcpy(caBuf+1, pccIndex2Format(cvI));
-	if ((cvI < cvF32) && xstrishex(pSrc) > 0) {			// leading X/x/0X/0x ie HEX?
-		Len = strlen(caBuf);
-		caBuf[Len-1] = CHR_x;
-	}
 	// concatenate the counter parsing
 	strcat(caBuf, "%n");
 	int iRV = sscanf(pSrc, caBuf, pX, &Len);
 	IF_PX(debugTRACK & (iRV == 0), "~[Err %*s]", Len ? Len : 8, pSrc);
+	stringTIMING_BYTES((iRV == 1) ? Len : 0);
 	return (iRV == 1) ? pSrc + Len : pcFAILURE;
 }
 
 char * cvParseRangeX32(char * pSrc, px_t pX, cvi_e cvI, x32_t Lo, x32_t Hi) {
 	x32_t X32;
-	vs_e cvS = xIndex2Size(cvI);
 	vf_e cvF = xIndex2Form(cvI);
-	IF_myASSERT(debugPARAM, cvS <= vs32B);
+	IF_myASSERT(debugPARAM, xIndex2Size(cvI) <= vs32B);
 	char * pTmp = cvParseValue(pSrc, xFormSize2Index(cvF, vs32B), (px_t) &X32);
 	if (pTmp == pcFAILURE)
 		return pTmp;
@@ -157,9 +407,8 @@ char * cvParseRangeX32(char * pSrc, px_t pX, cvi_e cvI, x32_t Lo, x32_t Hi) {
 
 char * cvParseRangeX64(char * pSrc, px_t pX, cvi_e cvI, x64_t Lo, x64_t Hi) {
 	x64_t X64;
-	vs_e cvS = xIndex2Size(cvI);
 	vf_e cvF = xIndex2Form(cvI);
-	IF_myASSERT(debugPARAM, cvS <= vs64B);
+	IF_myASSERT(debugPARAM, xIndex2Size(cvI) <= vs64B);
 	char * pTmp = cvParseValue(pSrc, xFormSize2Index(cvF, vs64B), (px_t) &X64);
 	if (pTmp == pcFAILURE) return pTmp;
 	switch(cvF) {
@@ -175,21 +424,476 @@ char * cvParseRangeX64(char * pSrc, px_t pX, cvi_e cvI, x64_t Lo, x64_t Hi) {
 	return pTmp;
 }
 
-char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
+/**
+ * @brief	count & convert leading decimal digits, 8 at a time
+ * @param[in]	pSrc - pointer to 1st digit
+ * @param[out]	pU64 - value of the digits, only valid if 1 -> 19 digits
+ * @return		number of digits, 0 if none or erFAILURE if not possible (near page end, big endian)
+ */
+static swarKERNEL int xStringParseDigitsSWAR(const char * pSrc, u64_t * pU64) {
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	u64_t Val = 0;
+	int Count = 0;
+	while (1) {
+		if (!swarPAGE_SAFE_N(pSrc, sizeof(u64_t)))
+			return erFAILURE;							// 8 byte load would cross into next page
+		u64_t X;
+		memcpy(&X, pSrc, sizeof(X));
+		X -= swarREP64(CHR_0);							// digits -> 0-9
+		u64_t M = (X | (X + swarREP64(0x76))) & swarREP64(0x80);	// non digit (incl borrow) bytes flagged
+		int N = M ? (__builtin_ctzll(M) >> 3) : 8;		// leading digits in this word
+		if (N == 0)
+			break;
+		X <<= (8 - N) * 8;								// digits to top, 0's (leading zeros) below
+		X = ((X * 10) + (X >> 8)) & 0x00FF00FF00FF00FFULL;		// 2 digits per u16
+		X = ((X * 100) + (X >> 16)) & 0x0000FFFF0000FFFFULL;	// 4 digits per u32
+		X = ((X * 10000) + (X >> 32)) & 0x00000000FFFFFFFFULL;	// 8 digits
+		Count += N;
+		if (Count > 19)
+			return erFAILURE;							// might overflow, leave to caller
+		Val = (Val * u64Pow10[N]) + X;
+		if (N < 8)
+			break;
+		pSrc += 8;
+	}
+	*pU64 = Val;
+	return Count;
+#else
+	return erFAILURE;
+#endif
+}
+
+/**
+ * @brief	isspace() equivalent without the library call, ' ' & '\t' -> '\r'
+ */
+static inline bool bStringIsSpace(int iChr) { return iChr == CHR_SPACE || (unsigned) (iChr - CHR_TAB) <= (CHR_CR - CHR_TAB); }
+
+/**
+ * @brief	parse a single integer value, decimal converted inline, other forms as pcStringParseInteger()
+ * @param[in]	cvF - form of cvI, vfUXX or vfIXX, as from xIndex2Form()
+ * @param[in]	uMax - largest unsigned magnitude of the type, as for pcStringParseIntegerN()
+ */
+static char * pcStringParseIntegerFast(char * pSrc, cvi_e cvI, vf_e cvF, u64_t uMax, x64_t * pX64) {
+	char * pTmp = pSrc;
+	bool bNeg = false;
+	if (*pTmp == CHR_MINUS || *pTmp == CHR_PLUS)
+		bNeg = (*pTmp++ == CHR_MINUS);
+	u64_t U64;
+	int Count = (*pTmp == CHR_0 && (pTmp[1] == CHR_x || pTmp[1] == CHR_X)) ? erFAILURE : xStringParseDigitsSWAR(pTmp, &U64);
+	if (Count <= 0)										// no digits, hex or not possible
+		return pcStringParseInteger(pSrc, cvI, pX64);	// all error handling there
+	if (cvF == vfIXX)
+		uMax = (uMax >> 1) + bNeg;						// 127 or 128 for 8 bit etc
+	else if (bNeg && U64)
+		return pcFAILURE;								// negative unsigned
+	if (U64 > uMax)
+		return pcFAILURE;
+	pX64->u64 = bNeg ? -U64 : U64;
+	return pTmp + Count;
+}
+
+int	xStringParseValues(char * pSrc, const delim_set_t * psSet, cvi_e cvI, px_t pX, size_t Max, const x64_t * pRange, int * pErr) {
+	stringTIMING_START("xStringParseValues", pSrc);
+	vf_e cvF = xIndex2Form(cvI);
+	vs_e cvS = xIndex2Size(cvI);
+	IF_myASSERT(debugPARAM, halMemoryANY((void*) pSrc) && halMemorySRAM(pX.pv) && cvF != vfSXX);
+	u64_t uMax = (cvS == vs64B) ? UINT64_MAX : (1ULL << (8 << cvS)) - 1;
+	size_t Idx = 0;
+	int Err = erFAILURE;
+	while (bStringIsSpace(*pSrc))
+		++pSrc;
+	while (*pSrc) {
+		if (Idx == Max) {								// no space for this value
+			Err = Idx;
+			break;
+		}
+		x64_t X64;
+		char * pTmp;
+		if (cvF == vfFXX) {
+			if (cvI == cvF32) {
+				f32_t F32;
+				pTmp = pcStringParseFloat(pSrc, cvI, (px_t) &F32);
+				X64.f64 = F32;							// exact, stored back as f32_t
+			} else {
+				pTmp = pcStringParseFloat(pSrc, cvI, (px_t) &X64.f64);
+			}
+		} else {
+			pTmp = pcStringParseIntegerFast(pSrc, cvI, cvF, uMax, &X64);
+		}
+		if (pTmp == pcFAILURE || (pRange && ((cvF == vfUXX && (X64.u64 < pRange[0].u64 || X64.u64 > pRange[1].u64)) ||
+			(cvF == vfIXX && (X64.i64 < pRange[0].i64 || X64.i64 > pRange[1].i64)) ||
+			(cvF == vfFXX && (X64.f64 < pRange[0].f64 || X64.f64 > pRange[1].f64))))) {
+			Err = Idx;
+			break;
+		}
+		char * pNext = pTmp;							// separator: whitespace and/or 1 delimiter
+		while (bStringIsSpace(*pNext))
+			++pNext;
+		if (psSet && *pNext && bStringDelimTest(psSet, *pNext)) {
+			++pNext;
+			while (bStringIsSpace(*pNext))
+				++pNext;
+			if (*pNext == 0)
+				Err = Idx + 1;							// trailing delimiter, value missing
+		} else if (pNext == pTmp && *pNext) {			// value followed by junk
+			Err = Idx;
+			break;
+		}
+		switch (cvI) {									// store inline, no call per value
+		case cvU08: case cvI08:	pX.pu8[Idx] = X64.u64;		break;
+		case cvU16: case cvI16:	pX.pu16[Idx] = X64.u64;		break;
+		case cvU32: case cvI32:	pX.pu32[Idx] = X64.u64;		break;
+		case cvF32:				pX.pf32[Idx] = X64.f64;		break;
+		default:				pX.pu64[Idx] = X64.u64;		break;
+		}
+		++Idx;
+		pSrc = pNext;
+	}
+	if (pErr)
+		*pErr = Err;
+	stringTIMING_END(pSrc);
+	return Idx;
+}
+
+/**
+ * @brief	days in month, closed form
+ * @param[in]	Year - full year, 1970 etc
+ * @param[in]	Mon - month 1 -> 12
+ */
+static int xStringDaysInMonth(int Year, int Mon) {
+	if (Mon == 2)
+		return ((Year & 3) == 0 && ((Year % 100) != 0 || (Year % 400) == 0)) ? 29 : 28;
+	return 30 + ((Mon ^ (Mon >> 3)) & 1);				// 31 for Jan/Mar/May/Jul/Aug/Oct/Dec
+}
+
+/**
+ * @brief	days since 1970/01/01 for a proleptic Gregorian date, H. Hinnant days_from_civil()
+ * @param[in]	Mon - month 1 -> 12
+ * @param[in]	Day - day of month, linear so 0 (day not specified) gives the last day of prior month
+ */
+static inline i32_t xStringDaysCivil(int Year, int Mon, int Day) {
+	Year -= (Mon <= 2);									// year starts 1 March, leap day last
+	int Era = ((Year >= 0) ? Year : Year - 399) / 400;
+	int YoE = Year - (Era * 400);						// 0 -> 399
+	int DoY = ((153 * (Mon + ((Mon > 2) ? -3 : 9))) + 2) / 5 + Day - 1;	// 0 -> 365
+	int DoE = (YoE * 365) + (YoE / 4) - (YoE / 100) + DoY;	// 0 -> 146096
+	return (Era * 146097) + DoE - 719468;
+}
+
+/**
+ * @brief	days since the start (1 Jan) of YEAR_BASE_MIN, as for xTimeCalcDaysToDate()
+ */
+static inline i32_t xStringDaysFromCivil(int Year, int Mon, int Day) {
+	return xStringDaysCivil(Year, Mon, Day) - xStringDaysCivil(YEAR_BASE_MIN, 1, 1);
+}
+
+/**
+ * @brief	inverse of xStringDaysFromCivil(), days since 1 Jan YEAR_BASE_MIN (>= 0) to date
+ */
+static void vStringCivilFromDays(i32_t Days, int * pYear, int * pMon, int * pDay) {
+	u32_t Z = Days + xStringDaysCivil(YEAR_BASE_MIN, 1, 1) + 719468;	// days since 0000-03-01
+	u32_t Era = Z / 146097;
+	u32_t DoE = Z - (Era * 146097);						// 0 -> 146096
+	u32_t YoE = (DoE - (DoE / 1460) + (DoE / 36524) - (DoE / 146096)) / 365;	// 0 -> 399
+	u32_t DoY = DoE - ((365 * YoE) + (YoE / 4) - (YoE / 100));	// 0 -> 365, from 1 March
+	u32_t MP = ((5 * DoY) + 2) / 153;					// 0 -> 11, March = 0
+	*pDay = DoY - (((153 * MP) + 2) / 5) + 1;
+	*pMon = (MP < 10) ? MP + 3 : MP - 9;
+	*pYear = (Era * 400) + YoE + (*pMon <= 2);
+}
+
+/**
+ * @brief	complete the tm_t fields and build the timestamp from parsed date/time components
+ * @param[in]	flag - DATETIME_?_OK flags of the components found
+ * @param[in]	uSecs - microseconds component
+ */
+static void vStringParseDateTimeDone(u32_t flag, u32_t uSecs, u64_t * pTStamp, tm_t * psTM) {
+	u32_t Secs;
+	if (flag & DATETIME_YEAR_OK) {						// full timestamp data found?
+		int Year = psTM->tm_year + YEAR_BASE_MIN;
+		i32_t Days = xStringDaysFromCivil(Year, psTM->tm_mon + 1, psTM->tm_mday);
+		psTM->tm_wday = (Days + timeEPOCH_DAY_0_NUM) % DAYS_IN_WEEK;
+		psTM->tm_yday = Days - xStringDaysFromCivil(Year, 1, 1);
+		Secs = ((u32_t) Days * SECONDS_IN_DAY) + (psTM->tm_hour * SECONDS_IN_HOUR) + (psTM->tm_min * SECONDS_IN_MINUTE) + psTM->tm_sec;
+	} else {
+		Secs = xTimeCalcSeconds(psTM, 1);
+	}
+	*pTStamp = xTimeMakeTimeStamp(Secs, uSecs);
+	IF_PX(debugTRACK && OPT_GET(dbgSyntax), "flag=0x%X  uS=%'llu  wday=%d  yday=%d  y=%d  m=%d  d=%d  %dh%02dm%02ds" strNL,
+			(unsigned) flag, (unsigned long long) *pTStamp, psTM->tm_wday, psTM->tm_yday, psTM->tm_year,
+			psTM->tm_mon, psTM->tm_mday, psTM->tm_hour, psTM->tm_min, psTM->tm_sec);
+}
+
+/**
+ * @brief	convert 2 decimal digits to a value
+ * @return	0 -> 99 or erFAILURE if either character is not a digit
+ * @note	2nd character only read if the 1st is a digit, never beyond the terminator
+ */
+static int xStringParseDigits2(const char * pSrc) {
+	u8_t Hi = pSrc[0] - CHR_0;
+	if (Hi > 9)
+		return erFAILURE;
+	u8_t Lo = pSrc[1] - CHR_0;
+	return (Lo > 9) ? erFAILURE : (Hi * 10) + Lo;
+}
+
+/**
+ * @brief	convert "hh:mm:ss" to hours, minutes and seconds, a word at a time where possible
+ * @return	erSUCCESS or erFAILURE if layout not as expected, values not range checked
+ */
+static swarKERNEL int xStringParseHMS(const char * pSrc, int * phh, int * pmm, int * pss) {
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	if (swarPAGE_SAFE_N(pSrc, sizeof(u64_t))) {			// 8 byte load stays in page
+		u64_t X;
+		memcpy(&X, pSrc, sizeof(X));
+		X -= 0x30303A30303A3030ULL;						// "hh:mm:ss" -> 0-9 in digits, 0 in ':'
+		if (((X | (X + swarREP64(0x76))) & swarREP64(0x80)) || (X & 0x0000FF0000FF0000ULL))
+			return erFAILURE;							// non digit, borrow OR colon missing
+		*phh = ((X & 0xFF) * 10) + ((X >> 8) & 0xFF);
+		*pmm = (((X >> 24) & 0xFF) * 10) + ((X >> 32) & 0xFF);
+		*pss = (((X >> 48) & 0xFF) * 10) + (X >> 56);
+		return erSUCCESS;
+	}
+#endif
+	if ((*phh = xStringParseDigits2(pSrc)) < 0 || pSrc[2] != CHR_COLON ||
+		(*pmm = xStringParseDigits2(pSrc+3)) < 0 || pSrc[5] != CHR_COLON ||
+		(*pss = xStringParseDigits2(pSrc+6)) < 0)
+		return erFAILURE;
+	return erSUCCESS;
+}
+
+/**
+ * @brief	validate date and set the date fields and day number
+ * @return	true if valid, else false with date fields unchanged
+ */
+static bool bStringDateSet(dt_ctx_t * psDate, int YY, int MM, int DD) {
+	if (OUTSIDE(YEAR_BASE_MIN, YY, YEAR_BASE_MAX) || OUTSIDE(1, MM, MONTHS_IN_YEAR) ||
+		OUTSIDE(1, DD, xStringDaysInMonth(YY, MM)))
+		return false;
+	psDate->Year = YY;
+	psDate->Mon = MM;
+	psDate->MDay = DD;
+	psDate->Days = xStringDaysFromCivil(YY, MM, DD);
+	return true;
+}
+
+/**
+ * @brief	date part of the canonical CCYY-MM-DDThh:mm:ss[.ffffff][Z] fast path
+ * @brief	separator and digit positions checked in a single pass and digits converted directly
+ * @param[out]	psDate - date fields and day number updated only if valid
+ * @return	true if valid canonical date, else false
+ */
+static bool bStringParseISODate(const char * pSrc, dt_ctx_t * psDate) {
+	int CC, YY, MM, DD;
+	if ((CC = xStringParseDigits2(pSrc)) < 0 || (YY = xStringParseDigits2(pSrc+2)) < 0 ||
+		(pSrc[4] != CHR_MINUS && pSrc[4] != CHR_FWDSLASH) || (MM = xStringParseDigits2(pSrc+5)) < 0 ||
+		(pSrc[7] != CHR_MINUS && pSrc[7] != CHR_FWDSLASH) || (DD = xStringParseDigits2(pSrc+8)) < 0)
+		return false;
+	return bStringDateSet(psDate, (CC * 100) + YY, MM, DD);
+}
+
+/**
+ * @brief	fraction of a second, '.' followed by 1 to 6 digits
+ * @return	pointer to next character, scaled value in *puSecs, or pcFAILURE
+ */
+static char * pcStringParseFraction(char * pSrc, u32_t * puSecs) {
+	int Count = 0;
+	u32_t uSecs = 0;
+	while (INRANGE(CHR_0, pSrc[Count + 1], CHR_9)) {
+		if (++Count > 6)
+			return pcFAILURE;
+		uSecs = (uSecs * 10) + pSrc[Count] - CHR_0;
+	}
+	if (Count == 0)
+		return pcFAILURE;
+	for (int i = Count; i < 6; ++i)
+		uSecs *= 10;									// scale to microseconds
+	*puSecs = uSecs;
+	return pSrc + Count + 1;
+}
+
+/**
+ * @brief	time part of the canonical fast path, from the 'T' separator following the date
+ * @param[in]	psDate - date fields, as from bStringParseISODate()
+ * @param[out]	psTM - pointer to tm_t to be filled, NULL if only the timestamp is required
+ * @return	updated pointer as for pcStringParseDateTime() or NULL if layout or values not
+ * 			as expected, caller must then use the flexible parser
+ */
+static char * pcStringParseISOTime(const dt_ctx_t * psDate, char * pSrc, u64_t * pTStamp, tm_t * psTM) {
+	int hh, mm, ss;
+	if ((pSrc[0] != CHR_T && pSrc[0] != CHR_t && pSrc[0] != CHR_SPACE) ||
+		xStringParseHMS(pSrc+1, &hh, &mm, &ss) == erFAILURE || hh >= HOURS_IN_DAY || mm >= MINUTES_IN_HOUR || ss >= SECONDS_IN_MINUTE)
+		return NULL;
+	pSrc += sizeof("Thh:mm:ss") - 1;
+	u32_t uSecs = 0;
+	if (*pSrc == CHR_FULLSTOP) {						// fraction, 1 to 6 digits
+		pSrc = pcStringParseFraction(pSrc, &uSecs);
+		if (pSrc == pcFAILURE || (*pSrc != 0 && *pSrc != CHR_SPACE && *pSrc != CHR_Z && *pSrc != CHR_z))
+			return NULL;
+	} else if (*pSrc == CHR_S || *pSrc == CHR_s) {		// "s" fraction separator, leave to flexible parser
+		return NULL;
+	}
+	if (*pSrc == CHR_Z || *pSrc == CHR_z)
+		++pSrc;											// skip over trailing 'Z'
+	if (psTM) {
+		memset(psTM, 0, sizeof(tm_t));
+		psTM->tm_year = psDate->Year - YEAR_BASE_MIN;
+		psTM->tm_mon = psDate->Mon - 1;
+		psTM->tm_mday = psDate->MDay;
+		psTM->tm_hour = hh;
+		psTM->tm_min = mm;
+		psTM->tm_sec = ss;
+		psTM->tm_wday = (psDate->Days + timeEPOCH_DAY_0_NUM) % DAYS_IN_WEEK;
+		psTM->tm_yday = psDate->Days - xStringDaysFromCivil(psDate->Year, 1, 1);
+	}
+	*pTStamp = xTimeMakeTimeStamp(((u32_t) psDate->Days * SECONDS_IN_DAY) + (hh * SECONDS_IN_HOUR) + (mm * SECONDS_IN_MINUTE) + ss, uSecs);
+	return pSrc;
+}
+
+/**
+ * @brief	fast path for canonical CCYY-MM-DDThh:mm:ss[.ffffff][Z] timestamps
+ * @return	as for pcStringParseISOTime()
+ */
+static char * pcStringParseISO8601(char * pSrc, u64_t * pTStamp, tm_t * psTM) {
+	dt_ctx_t sDate;
+	if (bStringParseISODate(pSrc, &sDate) == false)
+		return NULL;
+	return pcStringParseISOTime(&sDate, pSrc + sizeof(sDate.caDate), pTStamp, psTM);
+}
+
+/**
+ * @brief	fold 3 letters to lower case and pack as a single value for comparison with nameKEY()
+ * @return	packed value, 0 if terminated early
+ */
+static u32_t xStringNameKey(const char * pSrc) {
+	if (pSrc[0] == 0 || pSrc[1] == 0)
+		return 0;										// never read beyond the terminator
+	return nameKEY(pSrc[0] | 0x20, pSrc[1] | 0x20, pSrc[2] | 0x20);	// only letters fold to letters
+}
+
+/**
+ * @brief	HTTP date month name
+ * @return	1 -> 12 or erFAILURE
+ */
+static int xStringParseMonthName(const char * pSrc) {
+	switch (xStringNameKey(pSrc)) {
+	case nameKEY('j','a','n'):	return 1;
+	case nameKEY('f','e','b'):	return 2;
+	case nameKEY('m','a','r'):	return 3;
+	case nameKEY('a','p','r'):	return 4;
+	case nameKEY('m','a','y'):	return 5;
+	case nameKEY('j','u','n'):	return 6;
+	case nameKEY('j','u','l'):	return 7;
+	case nameKEY('a','u','g'):	return 8;
+	case nameKEY('s','e','p'):	return 9;
+	case nameKEY('o','c','t'):	return 10;
+	case nameKEY('n','o','v'):	return 11;
+	case nameKEY('d','e','c'):	return 12;
+	default:					return erFAILURE;
+	}
+}
+
+/**
+ * @brief	HTTP date day name, only validated, weekday is calculated from the date
+ * @return	0 (Sunday) -> 6 or erFAILURE
+ */
+static int xStringParseDayName(const char * pSrc) {
+	switch (xStringNameKey(pSrc)) {
+	case nameKEY('s','u','n'):	return 0;
+	case nameKEY('m','o','n'):	return 1;
+	case nameKEY('t','u','e'):	return 2;
+	case nameKEY('w','e','d'):	return 3;
+	case nameKEY('t','h','u'):	return 4;
+	case nameKEY('f','r','i'):	return 5;
+	case nameKEY('s','a','t'):	return 6;
+	default:					return erFAILURE;
+	}
+}
+
+/**
+ * @brief	HTTP/1.1 date formats (RFC 9110 section 5.6.7)
+ * 				Fri, 31 Dec 1999 23:59:59 GMT		IMF-fixdate (RFC 1123)
+ *				Friday, 31-Dec-99 23:59:59 GMT		RFC 850, 2 digit year 70 -> 99 = 19xx else 20xx
+ *				Fri Dec 31 23:59:59 1999			asctime(), day of month may be " 1"
+ * @return	updated pointer as for pcStringParseDateTime() or NULL if not an HTTP date
+ */
+static char * pcStringParseHTTPDate(char * pSrc, u64_t * pTStamp, tm_t * psTM) {
+	static const char * const pcDayRest[DAYS_IN_WEEK] = { "day", "day", "sday", "nesday", "rsday", "day", "urday" };
+	int CC, YY, MM, DD, Day;
+	bool bAsc = false;
+	size_t Len = xstrnlen(pSrc, sizeof("Fri, 31 Dec 1999 23:59:59 GMT") - 1);
+	if (Len < (sizeof("Fri Dec 31 23:59:59 1999") - 1) || (Day = xStringParseDayName(pSrc)) == erFAILURE)
+		return NULL;									// shortest format fits, fixed offsets can be read
+	pSrc += 3;
+	if (pSrc[0] == CHR_COMMA && pSrc[1] == CHR_SPACE) {	// IMF-fixdate
+		if (Len < (sizeof("Fri, 31 Dec 1999 23:59:59 GMT") - 1))
+			return NULL;
+		pSrc += 2;
+		if ((DD = xStringParseDigits2(pSrc)) < 0 || pSrc[2] != CHR_SPACE ||
+			(MM = xStringParseMonthName(pSrc+3)) < 0 || pSrc[6] != CHR_SPACE ||
+			(CC = xStringParseDigits2(pSrc+7)) < 0 || (YY = xStringParseDigits2(pSrc+9)) < 0)
+			return NULL;
+		YY += CC * 100;
+		pSrc += sizeof("31 Dec 1999") - 1;
+	} else if (isalpha((int) *pSrc)) {					// RFC 850, full day name
+		size_t sRest = strlen(pcDayRest[Day]);
+		if (xstrncmpNC(pSrc, pcDayRest[Day], sRest) == 0)
+			return NULL;
+		pSrc += sRest;
+		if (pSrc[0] != CHR_COMMA || pSrc[1] != CHR_SPACE ||
+			xstrnlen(pSrc, sizeof(", 31-Dec-99 23:59:59 GMT") - 1) < (sizeof(", 31-Dec-99 23:59:59 GMT") - 1))
+			return NULL;
+		pSrc += 2;
+		if ((DD = xStringParseDigits2(pSrc)) < 0 || pSrc[2] != CHR_MINUS ||
+			(MM = xStringParseMonthName(pSrc+3)) < 0 || pSrc[6] != CHR_MINUS ||
+			(YY = xStringParseDigits2(pSrc+7)) < 0)
+			return NULL;
+		YY += (YY < 70) ? 2000 : 1900;
+		pSrc += sizeof("31-Dec-99") - 1;
+	} else if (pSrc[0] == CHR_SPACE) {					// asctime()
+		if ((MM = xStringParseMonthName(pSrc+1)) < 0 || pSrc[4] != CHR_SPACE)
+			return NULL;
+		pSrc += 5;
+		if (pSrc[0] == CHR_SPACE)
+			DD = isdigit((int) pSrc[1]) ? pSrc[1] - CHR_0 : erFAILURE;
+		else
+			DD = xStringParseDigits2(pSrc);
+		pSrc += 2;										// year follows " hh:mm:ss"
+		if (DD < 0 || pSrc[9] != CHR_SPACE || (CC = xStringParseDigits2(pSrc+10)) < 0 ||
+			(YY = xStringParseDigits2(pSrc+12)) < 0)
+			return NULL;
+		YY += CC * 100;
+		bAsc = true;
+	} else {
+		return NULL;
+	}
+	dt_ctx_t sDate;
+	if (bStringDateSet(&sDate, YY, MM, DD) == false || pSrc[0] != CHR_SPACE)
+		return NULL;
+	char * pTmp = pcStringParseISOTime(&sDate, pSrc, pTStamp, psTM);	// " hh:mm:ss"
+	if (pTmp == NULL)
+		return NULL;
+	if (bAsc)											// no fraction or 'Z' before the year
+		return (pTmp == pSrc + sizeof(" hh:mm:ss") - 1) ? pTmp + sizeof(" CCYY") - 1 : NULL;
+	return xstrncmpNC(pTmp, " GMT", sizeof(" GMT") - 1) ? pTmp + sizeof(" GMT") - 1 : NULL;
+}
+
+/**
+ * @brief	flexible date/time parser, leading spaces already skipped
+ */
+static char * pcStringParseFlexible(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 	u32_t flag = 0;
 	/* TPmax	= ThisPar max length+1
 	 * TPact	= ThisPar actual length ( <0=error  0=not found  >0=length )
 	 * NPact	= NextPar actual length
 	 * TPlim	= ThisPar max value */
 	int	Value, TPlim, TPact, NPact;
-	size_t TPmax;
+	int TPmax;
 	memset(psTM, 0, sizeof(struct tm));					// ensure all start as 0
-	while (*pSrc == CHR_SPACE)							// make sure no leading spaces ....
-		++pSrc;
 
 	// check CCYY?MM? ahead
-	TPact = xStringFindDelim(pSrc, delimDATE1, sizeof("CCYY"));
-	NPact = (TPact > 0) ? xStringFindDelim(pSrc+TPact+1, delimDATE1, sizeof("MM")) : 0;
+	TPact = xStringFindDelimSet(pSrc, &delimDATE1, sizeof("CCYY"));
+	NPact = (TPact > 0) ? xStringFindDelimSet(pSrc+TPact+1, &delimDATE1, sizeof("MM")) : 0;
 	u8_t Option = OPT_GET(dbgSyntax);
 	IF_PX(debugTRACK && Option, "C: TPact=%d  NPact=%d", TPact, NPact);
 	if (NPact >= 1) {
@@ -204,8 +908,8 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 	IF_PX(debugTRACK && Option, "  Val=%d" strNL, psTM->tm_year);
 
 	// check for MM?DD? ahead
-	TPact = xStringFindDelim(pSrc, delimDATE1, sizeof("MM"));
-	NPact = (TPact > 0) ? xStringFindDelim(pSrc+TPact+1, delimDATE2, sizeof("DD")) : 0;
+	TPact = xStringFindDelimSet(pSrc, &delimDATE1, sizeof("MM"));
+	NPact = (TPact > 0) ? xStringFindDelimSet(pSrc+TPact+1, &delimDATE2, sizeof("DD")) : 0;
 	IF_PX(debugTRACK && Option, "M: TPact=%d  NPact=%d", TPact, NPact);
 
 	if ((flag & DATETIME_YEAR_OK) || (NPact == 2) || (NPact == 0 && TPact > 0 && pSrc[TPact+3] == 0)) {
@@ -220,12 +924,12 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 
 	if (flag & (DATETIME_YEAR_OK | DATETIME_MON_OK)) {
 		TPmax = sizeof("DD");
-		TPlim = xTimeCalcDaysInMonth(psTM);
+		TPlim = xStringDaysInMonth(psTM->tm_year + YEAR_BASE_MIN, psTM->tm_mon + 1);
 	} else {
 		TPmax = sizeof("365");
 		TPlim = DAYS_IN_YEAR;
 	}
-	TPact = xStringFindDelim(pSrc, delimDATE2, TPmax);
+	TPact = xStringFindDelimSet(pSrc, &delimDATE2, TPmax);
 	NPact = (TPact < 1 && pSrc[1] == 0) ? 1 : (TPact < 1 && pSrc[2] == 0) ? 2 : 0;
 	IF_PX(debugTRACK && Option, "D: TPmax=%d  TPact=%d  NPact=%d  TPlim=%d", TPmax, TPact, NPact, TPlim);
 
@@ -240,7 +944,8 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 
 	// calculate day of year ONLY if yyyy-mm-dd read in...
 	if (flag == (DATETIME_YEAR_OK | DATETIME_MON_OK | DATETIME_MDAY_OK)) {
-		psTM->tm_yday = xTimeCalcDaysYTD(psTM);
+		int Year = psTM->tm_year + YEAR_BASE_MIN;
+		psTM->tm_yday = xStringDaysFromCivil(Year, psTM->tm_mon + 1, psTM->tm_mday) - xStringDaysFromCivil(Year, 1, 1);
 		flag |= DATETIME_YDAY_OK;
 	}
 
@@ -255,8 +960,8 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 		TPmax = sizeof("8760");
 		TPlim = HOURS_IN_YEAR;
 	}
-	TPact = xStringFindDelim(pSrc, delimTIME1, TPmax);
-	NPact = (TPact > 0) ? xStringFindDelim(pSrc+TPact+1, delimTIME2, sizeof("HH")) : 0;
+	TPact = xStringFindDelimSet(pSrc, &delimTIME1, TPmax);
+	NPact = (TPact > 0) ? xStringFindDelimSet(pSrc+TPact+1, &delimTIME2, sizeof("HH")) : 0;
 	IF_PX(debugTRACK && Option, "H: TPmax=%d  TPact=%d  NPact=%d  TPlim=%d", TPmax, TPact, NPact, TPlim);
 
 	if (NPact > 0) {
@@ -278,8 +983,8 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 		TPmax = sizeof("525600");
 		TPlim = MINUTES_IN_YEAR;
 	}
-	TPact = xStringFindDelim(pSrc, delimTIME2, TPmax);
-	NPact = (TPact > 0) ? xStringFindDelim(pSrc+TPact+1, delimTIME3, sizeof("SS")) : 0;
+	TPact = xStringFindDelimSet(pSrc, &delimTIME2, TPmax);
+	NPact = (TPact > 0) ? xStringFindDelimSet(pSrc+TPact+1, &delimTIME3, sizeof("SS")) : 0;
 	IF_PX(debugTRACK && Option, "M: TPmax=%d  TPact=%d  NPact=%d  TPlim=%d", TPmax, TPact, NPact, TPlim);
 
 	if ((flag & DATETIME_HOUR_OK) || (NPact == 2) || (NPact == 0 && TPact > 0 && pSrc[TPact+3] == 0)) {
@@ -307,8 +1012,8 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 		TPmax = sizeof("31622399");
 		TPlim = SECONDS_IN_LEAPYEAR - 1;
 	}
-	TPact = xStringFindDelim(pSrc, delimTIME3, TPmax);
-	NPact = (TPact < 1) ? strlen(pSrc) : 0;
+	TPact = xStringFindDelimSet(pSrc, &delimTIME3, TPmax);
+	NPact = (TPact < 1) ? xstrnlen(pSrc, TPmax) : 0;	// only lengths < TPmax of interest
 	IF_PX(debugTRACK && Option, "S: TPmax=%d  TPact=%d  NPact=%d  TPlim=%d", TPmax, TPact, NPact, TPlim);
 
 	if ((flag & DATETIME_MIN_OK) || (TPact > 0) || (INRANGE(1, NPact, --TPmax))) {
@@ -322,15 +1027,15 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 
 	// check for [.0{...}Z] and skip as appropriate
 	int32_t uSecs = 0;
-	TPact = xStringFindDelim(pSrc, ".s", 1);
+	TPact = xStringFindDelimSet(pSrc, &delimUSEC1, 1);
 	TPmax = sizeof("999999");
 	if (TPact == 0) {
 		++pSrc;										// skip over '.'
-		TPact = xStringFindDelim(pSrc, "z ", TPmax);	// find position of Z/z in buffer
+		TPact = xStringFindDelimSet(pSrc, &delimUSEC2, TPmax);	// find position of Z/z in buffer
 		if (OUTSIDE(1, TPact, TPmax)) {
 		/* XXX valid terminator not found, but maybe a NUL ?
 		 * still a problem, what about junk after the last number ? */
-			NPact = strlen(pSrc);
+			NPact = xstrnlen(pSrc, TPmax);
 			if (OUTSIDE(1, NPact, --TPmax))
 				return pcFAILURE;
 			TPact = NPact;
@@ -341,36 +1046,357 @@ char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
 		TPact = 6 - TPact;
 		while (TPact--) uSecs *= 10;
 		flag |= DATETIME_MSEC_OK;						// mark as done
-		IF_PX(debugTRACK && Option, "  Val=%ld" strNL, uSecs);
+		IF_PX(debugTRACK && Option, "  Val=%ld" strNL, (long) uSecs);
 	}
 
 	if (pSrc[0] == CHR_Z || pSrc[0] == CHR_z)
 		++pSrc;											// skip over trailing 'Z'
 
-	u32_t Secs;
-	if (flag & DATETIME_YEAR_OK) {						// full timestamp data found?
-		psTM->tm_wday = (xTimeCalcDaysToDate(psTM) + timeEPOCH_DAY_0_NUM) % DAYS_IN_WEEK;
-		psTM->tm_yday = xTimeCalcDaysYTD(psTM);
-		Secs = xTimeCalcSeconds(psTM, 0);
+	vStringParseDateTimeDone(flag, uSecs, pTStamp, psTM);
+	return pSrc;
+}
+
+/**
+ * @brief	non canonical forms, HTTP dates (starting with a day name) else the flexible parser
+ */
+static char * pcStringParseOther(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
+	if (isalpha((int) *pSrc)) {
+		char * pTmp = pcStringParseHTTPDate(pSrc, pTStamp, psTM);
+		if (pTmp != NULL)
+			return pTmp;
+	}
+	return pcStringParseFlexible(pSrc, pTStamp, psTM);
+}
+
+char * pcStringParseDateTime(char * pSrc, u64_t * pTStamp, struct tm * psTM) {
+	stringTIMING_START("pcStringParseDateTime", pSrc);
+	while (*pSrc == CHR_SPACE)							// make sure no leading spaces ....
+		++pSrc;
+	char * pTmp = pcStringParseISO8601(pSrc, pTStamp, psTM);	// canonical form?
+	if (pTmp == NULL)
+		pTmp = pcStringParseOther(pSrc, pTStamp, psTM);
+	stringTIMING_END(pTmp);
+	return pTmp;
+}
+
+void vStringParseDateTimeInit(dt_ctx_t * psCtx) { memset(psCtx, 0, sizeof(dt_ctx_t)); }
+
+char * pcStringParseDateTimeCtx(dt_ctx_t * psCtx, char * pSrc, u64_t * pTStamp, tm_t * psTM) {
+	stringTIMING_START("pcStringParseDateTimeCtx", pSrc);
+	while (*pSrc == CHR_SPACE)
+		++pSrc;
+	char * pTmp = NULL;
+	if (psCtx->Valid && xstrncmpExact(pSrc, psCtx->caDate, sizeof(psCtx->caDate)))	// same date as last time?
+		pTmp = pcStringParseISOTime(psCtx, pSrc + sizeof(psCtx->caDate), pTStamp, psTM);
+	if (pTmp) {
+		++psCtx->Hits;
 	} else {
-		Secs = xTimeCalcSeconds(psTM, 1);
+		++psCtx->Miss;
+		if (bStringParseISODate(pSrc, psCtx)) {		// new canonical date, remember it
+			memcpy(psCtx->caDate, pSrc, sizeof(psCtx->caDate));
+			psCtx->Valid = true;
+			pTmp = pcStringParseISOTime(psCtx, pSrc + sizeof(psCtx->caDate), pTStamp, psTM);
+		}
+		if (pTmp == NULL) {
+			tm_t sTM;									// flexible parser works in tm_t
+			pTmp = pcStringParseOther(pSrc, pTStamp, psTM ? psTM : &sTM);
+		}
 	}
-	*pTStamp = xTimeMakeTimeStamp(Secs, uSecs);
-	IF_PX(debugTRACK && Option, "flag=%p  uS=%'llu  wday=%d  yday=%d  y=%d  m=%d  d=%d  %dh%02dm%02ds" strNL,
-			(void *) flag, *pTStamp, psTM->tm_wday, psTM->tm_yday, psTM->tm_year,
-			psTM->tm_mon, psTM->tm_mday, psTM->tm_hour, psTM->tm_min, psTM->tm_sec);
-	return pSrc;
+	stringTIMING_END(pTmp);
+	return pTmp;
+}
+
+int	xStringParseDateTimeBatch(const strv_t * psView, size_t Count, u64_t * pTStamp, u32_t * pValid) {
+	IF_myASSERT(debugPARAM, halMemoryANY((void *)psView) && halMemorySRAM(pTStamp) && halMemorySRAM(pValid));
+	stringTIMING_START("xStringParseDateTimeBatch", NULL);
+	dt_ctx_t sCtx;										// state kept across rows
+	vStringParseDateTimeInit(&sCtx);
+	char caBuf[stringDATETIME_MAX + 1];					// parser needs a terminator
+	size_t Bytes = 0;
+	int Valid = 0;
+	memset(pValid, 0, ((Count + 31) / 32) * sizeof(u32_t));
+	for (size_t Idx = 0; Idx < Count; ++Idx, ++psView) {
+		pTStamp[Idx] = 0;
+		size_t Len = psView->Len;
+		Bytes += Len;
+		while (Len && psView->pStr[Len - 1] == CHR_SPACE)
+			--Len;										// trailing spaces allowed
+		if (Len == 0 || Len > stringDATETIME_MAX)
+			continue;
+		memcpy(caBuf, psView->pStr, Len);
+		caBuf[Len] = 0;
+		char * pTmp = pcStringParseDateTimeCtx(&sCtx, caBuf, &pTStamp[Idx], NULL);
+		if (pTmp == pcFAILURE || *pTmp != 0) {			// invalid OR not the whole field
+			pTStamp[Idx] = 0;
+			continue;
+		}
+		pValid[Idx / 32] |= 1UL << (Idx % 32);
+		++Valid;
+	}
+	stringTIMING_BYTES(Bytes);
+	return Valid;
+}
+
+char * pcStringParseEpoch(char * pSrc, u64_t * pTStamp) {
+	stringTIMING_START("pcStringParseEpoch", pSrc);
+	while (*pSrc == CHR_SPACE)
+		++pSrc;
+	char * pTmp = pcStringParseISO8601(pSrc, pTStamp, NULL);	// no tm_t required
+	if (pTmp == NULL) {
+		tm_t sTM;										// flexible parser works in tm_t
+		pTmp = pcStringParseOther(pSrc, pTStamp, &sTM);
+	}
+	stringTIMING_END(pTmp);
+	return pTmp;
+}
+
+/**
+ * @brief	add Val * Scale to an accumulator
+ * @return	true if done, false if the result would overflow (accumulator unchanged)
+ */
+static bool bStringAddScaled(u64_t * pAcc, u64_t Val, u64_t Scale) {
+	if (Val > (UINT64_MAX - *pAcc) / Scale)
+		return false;
+	*pAcc += Val * Scale;
+	return true;
+}
+
+char * pcStringParseDuration(char * pSrc, u64_t * pUSecs) {
+	stringTIMING_START("pcStringParseDuration", pSrc);
+	static const u32_t u32Scale[] = { SECONDS_IN_DAY, SECONDS_IN_HOUR, SECONDS_IN_MINUTE, 1 };
+	char * pRet = pcFAILURE;
+	u64_t Secs = 0, Acc = 0;							// total & ':' separated fields (as seconds)
+	u32_t uSecs = 0;
+	int Next = 0, Colon = 0;							// next allowed unit (0=d -> 3=s), ':' count
+	while (*pSrc == CHR_SPACE)
+		++pSrc;
+	while (1) {
+		if (!isdigit((int) *pSrc))
+			goto exit;									// every field starts with a digit
+		u64_t Val = 0;
+		do {
+			if (Val > (UINT64_MAX - 9) / 10)
+				goto exit;
+			Val = (Val * 10) + *pSrc++ - CHR_0;
+		} while (isdigit((int) *pSrc));
+		int Idx;
+		switch (*pSrc) {
+		case CHR_D: case CHR_d:	Idx = 0;	break;
+		case CHR_H: case CHR_h:	Idx = 1;	break;
+		case CHR_M: case CHR_m:	Idx = 2;	break;
+		case CHR_S: case CHR_s:	Idx = 3;	break;
+		case CHR_COLON:									// [hh:]mm:ss, only days may precede
+			if (Next > 1 || Colon == 2 || (Colon && Val >= SECONDS_IN_MINUTE))
+				goto exit;
+			if (Acc > (UINT64_MAX - Val) / SECONDS_IN_MINUTE)
+				goto exit;
+			Acc = (Acc * SECONDS_IN_MINUTE) + Val;
+			++Colon;
+			++pSrc;
+			continue;
+		default:										// no unit, seconds
+			Idx = -1;
+		}
+		if (Idx < 0 || Colon) {
+			if (Colon && (Idx >= 0 || Val >= SECONDS_IN_MINUTE))
+				goto exit;
+			if (!bStringAddScaled(&Secs, Acc, SECONDS_IN_MINUTE) || !bStringAddScaled(&Secs, Val, 1))
+				goto exit;
+			bool Unit = false;
+			if (*pSrc == CHR_FULLSTOP) {				// N.ffffff[s]
+				pSrc = pcStringParseFraction(pSrc, &uSecs);
+				if (pSrc == pcFAILURE)
+					goto exit;
+				if (*pSrc == CHR_S || *pSrc == CHR_s) {
+					++pSrc;
+					Unit = true;
+				} else if (*pSrc == CHR_D || *pSrc == CHR_d || *pSrc == CHR_H || *pSrc == CHR_h || *pSrc == CHR_M || *pSrc == CHR_m) {
+					goto exit;							// "1.5h", only seconds take a fraction
+				}
+			}
+			if (Colon == 0 && Next > 0 && Unit == false)
+				goto exit;								// "1h30", minutes or seconds?
+			break;
+		}
+		if (Idx < Next || !bStringAddScaled(&Secs, Val, u32Scale[Idx]))
+			goto exit;									// units out of order or overflow
+		Next = Idx + 1;
+		++pSrc;
+		if (Idx == 3 && *pSrc == CHR_FULLSTOP) {		// Ns.ffffff
+			pSrc = pcStringParseFraction(pSrc, &uSecs);
+			if (pSrc == pcFAILURE)
+				goto exit;
+		}
+		if (Idx == 3 || !isdigit((int) *pSrc))
+			break;
+	}
+	if (Secs <= (UINT64_MAX - uSecs) / MICROS_IN_SECOND) {
+		*pUSecs = (Secs * MICROS_IN_SECOND) + uSecs;
+		pRet = pSrc;
+	}
+exit:
+	stringTIMING_END(pRet);
+	return pRet;
+}
+
+/**
+ * @brief	write value 0 -> 99 as 2 digits
+ */
+static inline char * pcStringPut2(char * pBuf, u32_t Val) {
+	memcpy(pBuf, &caDigitPairs[Val * 2], 2);
+	return pBuf + 2;
+}
+
+void vStringFormatISO8601Init(dt_fmt_t * psFmt) { psFmt->Days = -1; }
+
+char * pcStringFormatISO8601(dt_fmt_t * psFmt, char * pBuf, u64_t TStamp) {
+	IF_myASSERT(debugPARAM, halMemorySRAM((void*) psFmt) && halMemorySRAM((void*) pBuf) &&
+				TStamp <= xTimeMakeTimeStamp(SECONDS_IN_EPOCH_FUTURE, MICROS_IN_SECOND - 1));
+	u64_t Secs = TStamp / MICROS_IN_SECOND;
+	u32_t uSecs = TStamp % MICROS_IN_SECOND;
+	i32_t Days = Secs / SECONDS_IN_DAY;
+	u32_t SoD = Secs % SECONDS_IN_DAY;
+	if (Days != psFmt->Days) {							// new day, rebuild the date part
+		int Year, Mon, Day;
+		vStringCivilFromDays(Days, &Year, &Mon, &Day);
+		char * pTmp = pcStringPut2(psFmt->caDate, Year / 100);
+		pTmp = pcStringPut2(pTmp, Year % 100);
+		*pTmp++ = CHR_MINUS;
+		pTmp = pcStringPut2(pTmp, Mon);
+		*pTmp++ = CHR_MINUS;
+		pTmp = pcStringPut2(pTmp, Day);
+		*pTmp = CHR_T;
+		psFmt->Days = Days;
+	}
+	memcpy(pBuf, psFmt->caDate, sizeof(psFmt->caDate));
+	char * pTmp = pcStringPut2(pBuf + sizeof(psFmt->caDate), SoD / SECONDS_IN_HOUR);
+	*pTmp++ = CHR_COLON;
+	pTmp = pcStringPut2(pTmp, (SoD / SECONDS_IN_MINUTE) % MINUTES_IN_HOUR);
+	*pTmp++ = CHR_COLON;
+	pTmp = pcStringPut2(pTmp, SoD % SECONDS_IN_MINUTE);
+	*pTmp++ = CHR_FULLSTOP;
+	pTmp = pcStringPut2(pTmp, uSecs / 10000);
+	pTmp = pcStringPut2(pTmp, (uSecs / 100) % 100);
+	pTmp = pcStringPut2(pTmp, uSecs % 100);
+	*pTmp++ = CHR_Z;
+	*pTmp = 0;
+	return pTmp;
+}
+
+char * pcStringParseDateTimeN(char * pSrc, size_t sSrc, u64_t * pTStamp, tm_t * psTM) {
+	char caBuf[stringDATETIME_MAX + 1];					// bounded copy, parser needs a terminator
+	if (sSrc > stringDATETIME_MAX)
+		sSrc = stringDATETIME_MAX;
+	memcpy(caBuf, pSrc, sSrc);
+	caBuf[sSrc] = 0;
+	char * pTmp = pcStringParseDateTime(caBuf, pTStamp, psTM);
+	return (pTmp == pcFAILURE) ? pcFAILURE : pSrc + (pTmp - caBuf);
 }
 
 // #################################################################################################
 
-#define	stringTEST_FLAG			0x0000
+#ifndef stringTEST_FLAG
+	#define	stringTEST_FLAG		0x0000
+#endif
 #define	stringTEST_EPOCH		(stringTEST_FLAG & 0x0001)
 #define	stringTEST_DATES		(stringTEST_FLAG & 0x0002)
 #define	stringTEST_TIMES		(stringTEST_FLAG & 0x0004)
 #define	stringTEST_DTIME		(stringTEST_FLAG & 0x0008)
 #define	stringTEST_RELDAT		(stringTEST_FLAG & 0x0010)
 #define	stringTEST_PARSE		(stringTEST_FLAG & 0x0020)
+#define	stringTEST_SWAR			(stringTEST_FLAG & 0x0040)
+#define	stringTEST_IPADDR		(stringTEST_FLAG & 0x0080)
+#define	stringTEST_DURATION		(stringTEST_FLAG & 0x0100)
+#define	stringTEST_ISOFMT		(stringTEST_FLAG & 0x0200)
+#define	stringTEST_V2STR		(stringTEST_FLAG & 0x0400)
+#define	stringTEST_FLOAT		(stringTEST_FLAG & 0x0800)
+#define	stringTEST_VALUES		(stringTEST_FLAG & 0x1000)
+#define	stringTEST_HASH			(stringTEST_FLAG & 0x2000)
+
+#define	stringTEST_CHECK(ok)	PX((ok) ? " #%d Passed" strNL : " #%d Failed" strNL, __LINE__)
+
+#if (stringTEST_SWAR)
+/**
+ * @brief	compare word-at-a-time kernels against the byte loop references for a single source
+ * @return	number of mismatches
+ */
+static int xStringTestSWARAt(char * pSrc, size_t Len) {
+	char caDstB[4 * swarSIZE], caDstW[4 * swarSIZE];
+	int Fail = 0;
+	for (size_t uMax = 1; uMax <= Len + 2; uMax += (uMax < Len) ? (Len / 2) + 1 : 1)
+		Fail += (xstrnlen(pSrc, uMax) != xstrnlenByte(pSrc, uMax));
+	Fail += (xstrnlen(pSrc, stringMAX_LEN) != xstrnlenByte(pSrc, stringMAX_LEN));
+	for (int xLen = 1; xLen <= (int) sizeof(caDstB); xLen += (xLen < (int) Len) ? ((int) Len / 2) + 1 : 1) {
+		memset(caDstB, 0xA5, sizeof(caDstB));
+		memset(caDstW, 0xA5, sizeof(caDstW));
+		Fail += (xstrncpy(caDstW, pSrc, xLen) != xstrncpyByte(caDstB, pSrc, xLen));
+		Fail += (memcmp(caDstB, caDstW, sizeof(caDstB)) != 0);
+	}
+	Fail += (xStringCountSpaces(pSrc) != xStringCountSpacesByte(pSrc));
+	Fail += (xStringCountCRLF(pSrc) != xStringCountCRLFByte(pSrc));
+	return Fail;
+}
+
+/**
+ * @brief	fill Len characters of a pattern, NUL, then more of the same that must not be counted
+ */
+static void vStringTestSWARFill(char * pSrc, size_t Len, const char * pcPat) {
+	size_t sPat = strlen(pcPat);
+	for (size_t i = 0; i < Len; ++i)
+		pSrc[i] = pcPat[i % sPat];
+	pSrc[Len] = 0;
+}
+
+/**
+ * @brief	verify word-at-a-time kernels against byte loop references, timing in host/string_bench.c
+ * @note	every length 0 -> 3 words at every start offset within a word, and ending in the last
+ * 			byte of a page, for text, space/tab and CR/LF runs
+ */
+static void vStringTestSWAR(void) {
+	static char caPage[2 * swarPAGE] __attribute__((aligned(swarPAGE)));
+	static const char * const pcPat[] = { "TheQuickBrownFox", " \t", "\r\n", " \t\r\nx" };
+	int FailOfs = 0, FailEnd = 0;
+	for (size_t Pat = 0; Pat < sizeof(pcPat) / sizeof(pcPat[0]); ++Pat) {
+		for (size_t Len = 0; Len <= 3 * swarSIZE; ++Len) {
+			for (size_t Ofs = 0; Ofs < swarSIZE; ++Ofs) {	// word aligned + Ofs, NUL followed by more
+				memset(caPage, pcPat[Pat][0], 8 * swarSIZE);
+				vStringTestSWARFill(caPage + Ofs, Len, pcPat[Pat]);
+				FailOfs += xStringTestSWARAt(caPage + Ofs, Len);
+			}
+			char * pSrc = caPage + swarPAGE - 1 - Len;	// terminator in last byte of the page
+			memset(caPage + swarPAGE, pcPat[Pat][0], swarSIZE);
+			vStringTestSWARFill(pSrc, Len, pcPat[Pat]);
+			FailEnd += xStringTestSWARAt(pSrc, Len);
+		}
+	}
+	stringTEST_CHECK(FailOfs == 0);
+	stringTEST_CHECK(FailEnd == 0);
+}
+#endif
+
+#if (stringTEST_V2STR)
+/**
+ * @brief	check unterminated formatter output against the expected text
+ */
+static bool bStringTestText(const char * pBuf, int Len, const char * pcExp) {
+	return (Len == (int) strlen(pcExp)) && (memcmp(pBuf, pcExp, Len) == 0);
+}
+#endif
+
+#if (stringTEST_FLOAT)
+/**
+ * @brief	parse pcSrc as cvF64 and cvF32, check the characters used and bit exact values (-0.0 != 0.0)
+ */
+static bool bStringTestFloat(const char * pcSrc, int Len, f64_t F64Exp, f32_t F32Exp) {
+	f64_t F64;
+	f32_t F32;
+	char * pTmp = pcStringParseFloat((char *) pcSrc, cvF64, (px_t) &F64);
+	if (pTmp == pcFAILURE || (pTmp - pcSrc) != Len || memcmp(&F64, &F64Exp, sizeof(F64)))
+		return false;
+	pTmp = pcStringParseFloat((char *) pcSrc, cvF32, (px_t) &F32);
+	return (pTmp != pcFAILURE) && (pTmp - pcSrc) == Len && memcmp(&F32, &F32Exp, sizeof(F32)) == 0;
+}
+#endif
 
 void x_string_general_test(void) {
 	#if	(stringTEST_EPOCH || stringTEST_DATES || stringTEST_TIMES || stringTEST_DTIME || stringTEST_RELDAT)
@@ -391,6 +1417,15 @@ void x_string_general_test(void) {
 	pTmp = pcStringParseToken(caBuf, pTmp, " ,;", 0, sizeof(caBuf));
 	pTmp = pcStringParseToken(caBuf, pTmp, " ,;", 0, sizeof(caBuf));
 	pTmp = pcStringParseToken(caBuf, pTmp, " ,;", 0, sizeof(caBuf));
+
+	strv_t sTok;										// same, without copying tokens
+	pTmp = caSrc;
+	do {
+		pTmp += xStringSkipDelim(pTmp, " ,;", 0);
+		pTmp = pcStringParseTokenView(&sTok, pTmp, " ,;");
+		PX("[%.*s]", (int) sTok.Len, sTok.pStr);
+	} while (sTok.Len);
+	PX(strNL);
 	#endif
 
 	#if	(stringTEST_EPOCH)
@@ -473,6 +1508,23 @@ void x_string_general_test(void) {
 
 	pcStringParseDateTime((char *) "2019-04/15t01h23:45s678901", &sTSZ.usecs, &sTM);
 	PX(sTM.tm_year!=49 || sTM.tm_mon!=3 || sTM.tm_mday!=15 || sTM.tm_hour!=1 || sTM.tm_min!=23 || sTM.tm_sec!=45 || (sTSZ.usecs % MILLION) != 678901 ? " #%d Failed" strNL : " #%d Passed" strNL, __LINE__);
+
+	pcStringParseDateTime((char *) "2100-01-01T00:00:00.000000Z", &sTSZ.usecs, &sTM);	// beyond 2038, Days * SECONDS_IN_DAY > INT32_MAX
+	stringTEST_CHECK(sTM.tm_year == 130 && sTM.tm_wday == 5 && sTSZ.usecs == 4102444800000000ULL);
+	pcStringParseDateTime((char *) "2100/01/01 00:00:00", &sTSZ.usecs, &sTM);
+	stringTEST_CHECK(sTM.tm_year == 130 && sTM.tm_wday == 5 && sTSZ.usecs == 4102444800000000ULL);
+
+	char * pcHTTP = pcStringParseDateTime((char *) "Fri, 31 Dec 1999 23:59:59 GMT", &sTSZ.usecs, &sTM);	// HTTP-date, 3 forms
+	stringTEST_CHECK(pcHTTP != pcFAILURE && *pcHTTP == 0 && sTSZ.usecs == 946684799000000ULL);
+	pcHTTP = pcStringParseDateTime((char *) "Friday, 31-Dec-99 23:59:59 GMT", &sTSZ.usecs, &sTM);
+	stringTEST_CHECK(pcHTTP != pcFAILURE && *pcHTTP == 0 && sTSZ.usecs == 946684799000000ULL);
+	pcHTTP = pcStringParseDateTime((char *) "Wednesday, 01-Jan-20 00:00:00 GMT", &sTSZ.usecs, &sTM);
+	stringTEST_CHECK(pcHTTP != pcFAILURE && *pcHTTP == 0 && sTSZ.usecs == 1577836800000000ULL);
+	pcHTTP = pcStringParseDateTime((char *) "Fri Dec 31 23:59:59 1999", &sTSZ.usecs, &sTM);
+	stringTEST_CHECK(pcHTTP != pcFAILURE && *pcHTTP == 0 && sTSZ.usecs == 946684799000000ULL);
+	stringTEST_CHECK(pcStringParseDateTime((char *) "Frixyz, 31-Dec-99 23:59:59 GMT", &sTSZ.usecs, &sTM) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseDateTime((char *) "Fridays, 31-Dec-99 23:59:59 GMT", &sTSZ.usecs, &sTM) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseDateTime((char *) "Frinesday, 31-Dec-99 23:59:59 GMT", &sTSZ.usecs, &sTM) == pcFAILURE);
 	#endif
 
 	#if	(stringTEST_RELDAT)
@@ -481,4 +1533,205 @@ void x_string_general_test(void) {
 	pcStringParseDateTime((char *) "1-1/1", &sTSZ.usecs, &sTM);
 	PX(sTM.tm_year!=1 || sTM.tm_mon!=3 || sTM.tm_mday!=15 || sTM.tm_hour!=0 || sTM.tm_min!=0 || sTM.tm_sec!=0 ? " #%d Failed" strNL : " #%d Passed" strNL, __LINE__);
 	#endif
+
+	#if	(stringTEST_SWAR)
+	vStringTestSWAR();
+	#endif
+
+	#if	(stringTEST_IPADDR)
+	u8_t u8Addr[16], Prefix;
+	char * pcAddr;
+	pcAddr = pcStringParseIpAddr((char *) "192.168.1.254", (px_t) u8Addr);
+	stringTEST_CHECK(pcAddr != pcFAILURE && *pcAddr == 0 && u8Addr[3] == 192 && u8Addr[0] == 254);	// 1st octet stored last
+	stringTEST_CHECK(pcStringParseIpAddr((char *) "192.168.1.1234", (px_t) u8Addr) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIpAddr((char *) "256.1.1.1", (px_t) u8Addr) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIpAddr((char *) "1.2.3", (px_t) u8Addr) == pcFAILURE);
+	pcAddr = pcStringParseIpCIDR((char *) "10.0.0.0/8", (px_t) u8Addr, &Prefix);
+	stringTEST_CHECK(pcAddr != pcFAILURE && *pcAddr == 0 && u8Addr[3] == 10 && Prefix == 8);
+	stringTEST_CHECK(pcStringParseIpCIDR((char *) "10.0.0.0/33", (px_t) u8Addr, &Prefix) == pcFAILURE);
+
+	pcAddr = pcStringParseIp6Addr((char *) "2001:db8::1", (px_t) u8Addr, NULL);
+	stringTEST_CHECK(pcAddr != pcFAILURE && *pcAddr == 0 && u8Addr[0] == 0x20 && u8Addr[3] == 0xB8 && u8Addr[14] == 0 && u8Addr[15] == 1);
+	pcAddr = pcStringParseIp6Addr((char *) "2001:db8::1234/64", (px_t) u8Addr, &Prefix);
+	stringTEST_CHECK(pcAddr != pcFAILURE && *pcAddr == 0 && u8Addr[14] == 0x12 && u8Addr[15] == 0x34 && Prefix == 64);
+	pcAddr = pcStringParseIp6Addr((char *) "::ffff:192.168.1.1", (px_t) u8Addr, NULL);
+	stringTEST_CHECK(pcAddr != pcFAILURE && *pcAddr == 0 && u8Addr[10] == 0xFF && u8Addr[12] == 192 && u8Addr[15] == 1);
+	pcAddr = pcStringParseIp6Addr((char *) "1:2:3:4:5:6:7:8", (px_t) u8Addr, NULL);
+	stringTEST_CHECK(pcAddr != pcFAILURE && *pcAddr == 0 && u8Addr[1] == 1 && u8Addr[15] == 8);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "::", (px_t) u8Addr, NULL) != pcFAILURE && u8Addr[0] == 0 && u8Addr[15] == 0);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "2001:db8::12345", (px_t) u8Addr, &Prefix) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "2001:db8::12345/64", (px_t) u8Addr, &Prefix) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "1:2:3:4:5:6:7:8:9", (px_t) u8Addr, NULL) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "1:2:3:4:5:6:7:8::", (px_t) u8Addr, NULL) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "1::2::3", (px_t) u8Addr, NULL) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseIp6Addr((char *) "1:2:", (px_t) u8Addr, NULL) == pcFAILURE);
+	#endif
+
+	#if	(stringTEST_DURATION)
+	u64_t uDur;
+	char * pcDur;
+	pcDur = pcStringParseDuration((char *) "1d2h3m4s", &uDur);
+	stringTEST_CHECK(pcDur != pcFAILURE && *pcDur == 0 && uDur == 93784ULL * MICROS_IN_SECOND);
+	pcDur = pcStringParseDuration((char *) "1:30:15.5", &uDur);
+	stringTEST_CHECK(pcDur != pcFAILURE && *pcDur == 0 && uDur == 5415500000ULL);
+	pcDur = pcStringParseDuration((char *) "2d 12:00:00", &uDur);		// stops at the space
+	stringTEST_CHECK(pcDur != pcFAILURE && *pcDur == CHR_SPACE && uDur == 172800ULL * MICROS_IN_SECOND);
+	pcDur = pcStringParseDuration((char *) "2d12:00:00", &uDur);
+	stringTEST_CHECK(pcDur != pcFAILURE && *pcDur == 0 && uDur == 216000ULL * MICROS_IN_SECOND);
+	pcDur = pcStringParseDuration((char *) "90.000001", &uDur);
+	stringTEST_CHECK(pcDur != pcFAILURE && *pcDur == 0 && uDur == 90000001ULL);
+	stringTEST_CHECK(pcStringParseDuration((char *) "1:60", &uDur) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseDuration((char *) "1m1h", &uDur) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseDuration((char *) "1h30", &uDur) == pcFAILURE);			// not 1h30m nor 1h30s
+	stringTEST_CHECK(pcStringParseDuration((char *) "1h30.5", &uDur) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseDuration((char *) "1.5h", &uDur) == pcFAILURE);			// not 1.5 seconds
+	stringTEST_CHECK(pcStringParseDuration((char *) "1:30.5m", &uDur) == pcFAILURE);
+	pcDur = pcStringParseDuration((char *) "1m30.5s", &uDur);
+	stringTEST_CHECK(pcDur != pcFAILURE && *pcDur == 0 && uDur == 90500000ULL);
+	stringTEST_CHECK(pcStringParseDuration((char *) "307445734561825861:00:00", &uDur) == pcFAILURE);	// Acc * 60 wraps
+	stringTEST_CHECK(pcStringParseDuration((char *) "18446744073709551616", &uDur) == pcFAILURE);
+	#endif
+
+	#if	(stringTEST_ISOFMT)
+	{	// formatter against gmtime_r() and back through the parser, full supported range
+		static const u32_t u32Secs[] = { 0, 59, 86399, 86400, 951782400, 951868799, 2147483647, 2147483648, 4107542400, SECONDS_IN_EPOCH_FUTURE };
+		char caFmt[stringISO8601_SIZE], caRef[stringISO8601_SIZE + 16];
+		dt_fmt_t sFmt;
+		struct tm sRef;
+		u64_t uRef, uBack;
+		int Fail = 0;
+		vStringFormatISO8601Init(&sFmt);
+		const u32_t Fixed = sizeof(u32Secs) / sizeof(u32Secs[0]);
+		for (u32_t i = 0; i < Fixed + 2000; ++i) {			// fixed cases, then spread over the range
+			u32_t Secs = (i < Fixed) ? u32Secs[i] : (i * 2147483U) + (i * 7919U);
+			u32_t uSecs = (i * 104729U) % MICROS_IN_SECOND;
+			time_t tRef = Secs;
+			uRef = xTimeMakeTimeStamp(Secs, uSecs);
+			gmtime_r(&tRef, &sRef);
+			snprintfx(caRef, sizeof(caRef), "%04d-%02d-%02dT%02d:%02d:%02d.%06uZ", sRef.tm_year + 1900, sRef.tm_mon + 1,
+					sRef.tm_mday, sRef.tm_hour, sRef.tm_min, sRef.tm_sec, (unsigned) uSecs);
+			pcStringFormatISO8601(&sFmt, caFmt, uRef);
+			if (strcmp(caFmt, caRef) || pcStringParseEpoch(caFmt, &uBack) == pcFAILURE || uBack != uRef) {
+				PX("  %s != %s" strNL, caFmt, caRef);
+				++Fail;
+			}
+		}
+		stringTEST_CHECK(Fail == 0);
+	}
+	#endif
+
+	#if	(stringTEST_V2STR)
+	char caV2S[stringVALUE_MAX + 1];
+	stringTEST_CHECK(xStringDigitsU32(0) == 1 && xStringDigitsU32(9) == 1 && xStringDigitsU32(10) == 2 && xStringDigitsU32(UINT32_MAX) == 10);
+	stringTEST_CHECK(xStringDigitsU64(4294967296ULL) == 10 && xStringDigitsU64(UINT64_MAX) == 20);
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU32ToDec(caV2S, 0), "0"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU32ToDec(caV2S, 9), "9"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU32ToDec(caV2S, 10), "10"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU32ToDec(caV2S, UINT32_MAX), "4294967295"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU64ToDec(caV2S, 0), "0"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU64ToDec(caV2S, 9), "9"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU64ToDec(caV2S, 10), "10"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU64ToDec(caV2S, UINT32_MAX), "4294967295"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU64ToDec(caV2S, 4294967296ULL), "4294967296"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringU64ToDec(caV2S, UINT64_MAX), "18446744073709551615"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringI32ToDec(caV2S, -1), "-1"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringI32ToDec(caV2S, INT32_MIN), "-2147483648"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringI64ToDec(caV2S, INT64_MAX), "9223372036854775807"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringI64ToDec(caV2S, INT64_MIN), "-9223372036854775808"));
+	for (int Width = 1; Width <= 16; ++Width) {			// each width, the low order Width nibbles
+		const char * pcExp = "0123456789ABCDEF";
+		bool bOK = bStringTestText(caV2S, xStringU64ToHex(caV2S, 0x0123456789ABCDEFULL, Width, true), pcExp + 16 - Width);
+		bOK = bOK && bStringTestText(caV2S, xStringU64ToHex(caV2S, UINT64_MAX, Width, false), "ffffffffffffffff" + 16 - Width);
+		if (bOK == false)
+			PX(" #%d Failed Width=%d" strNL, __LINE__, Width);
+	}
+	i64_t I64Min = INT64_MIN;
+	u64_t U64Max = UINT64_MAX;
+	stringTEST_CHECK(bStringTestText(caV2S, xStringValueToText(caV2S, sizeof(caV2S), cvI64, (px_t) &I64Min), "-9223372036854775808"));
+	stringTEST_CHECK(bStringTestText(caV2S, xStringValueToText(caV2S, sizeof(caV2S), cvU64, (px_t) &U64Max), "18446744073709551615"));
+	stringTEST_CHECK(xStringValueToText(caV2S, 19, cvU64, (px_t) &U64Max) == erFAILURE);	// 20 digits required
+	#endif
+
+	#if	(stringTEST_FLOAT)
+	stringTEST_CHECK(bStringTestFloat("1.5", 3, 1.5, 1.5f));						// fast path, exact
+	stringTEST_CHECK(bStringTestFloat("0.1", 3, 0.1, 0.1f));
+	stringTEST_CHECK(bStringTestFloat("123.456", 7, 123.456, 123.456f));
+	stringTEST_CHECK(bStringTestFloat("-2.5e-3", 7, -2.5e-3, -2.5e-3f));
+	stringTEST_CHECK(bStringTestFloat("-0", 2, -0.0, -0.0f));
+	stringTEST_CHECK(bStringTestFloat("9007199254740993", 16, 9007199254740992.0, 9007199254740992.0f));	// 2^53+1, ties to even
+	stringTEST_CHECK(bStringTestFloat("1e23", 4, 1e23, 1e23f));						// beyond exact powers of 10
+	stringTEST_CHECK(bStringTestFloat("4.9e-324", 8, 4.9e-324, 0.0f));				// smallest subnormal
+	stringTEST_CHECK(bStringTestFloat("3.4028235e38", 12, 3.4028235e38, 3.4028235e38f));
+	stringTEST_CHECK(bStringTestFloat("1e39", 4, 1e39, __builtin_inff()));
+	stringTEST_CHECK(bStringTestFloat("1e", 1, 1.0, 1.0f));						// exponent without digits not used
+	stringTEST_CHECK(bStringTestFloat("-0x1p3", 6, -8.0, -8.0f));
+	f64_t F64Nan;
+	char * pcNan = pcStringParseFloat((char *) "nan(", cvF64, (px_t) &F64Nan);
+	stringTEST_CHECK(pcNan != pcFAILURE && *pcNan == CHR_L_ROUND && F64Nan != F64Nan);	// unclosed, '(' not used
+	stringTEST_CHECK(pcStringParseFloat((char *) "abc", cvF64, (px_t) &F64Nan) == pcFAILURE);
+	stringTEST_CHECK(pcStringParseFloat((char *) "-.e1", cvF64, (px_t) &F64Nan) == pcFAILURE);
+	#endif
+
+	#if	(stringTEST_VALUES)
+	static const delim_set_t sValDelim = delimSET(',', ';');
+	static char caPage[2 * swarPAGE] __attribute__((aligned(swarPAGE)));
+	u8_t u8V[4]; u16_t u16V[4]; u32_t u32V[4]; u64_t u64V[4];
+	int Cnt, Err;
+	Cnt = xStringParseValues((char *) " 0, 255 ", &sValDelim, cvU08, (px_t) u8V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 2 && Err == erFAILURE && u8V[0] == 0 && u8V[1] == 255);
+	Cnt = xStringParseValues((char *) "-128 127 -129", &sValDelim, cvI08, (px_t) u8V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 2 && Err == 2 && (i8_t) u8V[0] == -128 && (i8_t) u8V[1] == 127);
+	Cnt = xStringParseValues((char *) "65535,65536", &sValDelim, cvU16, (px_t) u16V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 1 && Err == 1 && u16V[0] == 65535);
+	Cnt = xStringParseValues((char *) "-32768;32767", &sValDelim, cvI16, (px_t) u16V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 2 && Err == erFAILURE && (i16_t) u16V[0] == -32768 && (i16_t) u16V[1] == 32767);
+	Cnt = xStringParseValues((char *) "4294967295 4294967296", NULL, cvU32, (px_t) u32V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 1 && Err == 1 && u32V[0] == UINT32_MAX);
+	Cnt = xStringParseValues((char *) "-2147483648,2147483647", &sValDelim, cvI32, (px_t) u32V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 2 && Err == erFAILURE && (i32_t) u32V[0] == INT32_MIN && (i32_t) u32V[1] == INT32_MAX);
+	Cnt = xStringParseValues((char *) "18446744073709551615,18446744073709551616", &sValDelim, cvU64, (px_t) u64V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 1 && Err == 1 && u64V[0] == UINT64_MAX);
+	Cnt = xStringParseValues((char *) "-9223372036854775808,9223372036854775807", &sValDelim, cvI64, (px_t) u64V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 2 && Err == erFAILURE && (i64_t) u64V[0] == INT64_MIN && (i64_t) u64V[1] == INT64_MAX);
+
+	x64_t sRange[2] = { { .u64 = 10 }, { .u64 = 20 } };
+	Cnt = xStringParseValues((char *) "10,20,21", &sValDelim, cvU32, (px_t) u32V, 4, sRange, &Err);
+	stringTEST_CHECK(Cnt == 2 && Err == 2);
+	Cnt = xStringParseValues((char *) "9,10", &sValDelim, cvU32, (px_t) u32V, 4, sRange, &Err);
+	stringTEST_CHECK(Cnt == 0 && Err == 0);
+	Cnt = xStringParseValues((char *) "1,2,3", &sValDelim, cvU32, (px_t) u32V, 2, NULL, &Err);	// more than Max
+	stringTEST_CHECK(Cnt == 2 && Err == 2 && u32V[1] == 2);
+	Cnt = xStringParseValues((char *) "1,2x,3", &sValDelim, cvU32, (px_t) u32V, 4, NULL, &Err);	// junk after value
+	stringTEST_CHECK(Cnt == 1 && Err == 1);
+	Cnt = xStringParseValues((char *) "1,,2", &sValDelim, cvU32, (px_t) u32V, 4, NULL, &Err);
+	stringTEST_CHECK(Cnt == 1 && Err == 1);
+	Cnt = xStringParseValues((char *) "1,2, ", &sValDelim, cvU32, (px_t) u32V, 4, NULL, &Err);	// trailing delimiter
+	stringTEST_CHECK(Cnt == 2 && Err == 2);
+
+	// last digits in the final bytes of a page, 8 byte loads must fall back without changing the result
+	for (int Len = 1; Len <= 20; ++Len) {
+		char * pcEnd = caPage + swarPAGE - 1;			// terminator in last byte of the page
+		char * pcVal = pcEnd - Len;
+		memcpy(pcVal, "18446744073709551615", Len);		// leading digits of UINT64_MAX
+		*pcEnd = 0;
+		u64_t U64Exp = UINT64_MAX / u64Pow10[20 - Len];
+		Cnt = xStringParseValues(pcVal, NULL, cvU64, (px_t) u64V, 4, NULL, &Err);
+		if (Cnt != 1 || Err != erFAILURE || u64V[0] != U64Exp)
+			PX(" #%d Failed Len=%d" strNL, __LINE__, Len);
+	}
+	#endif
+
+	#if	(stringTEST_HASH)
+	static char * const pcHashOK[] = { "set", "settings", "show", "status", "reboot", "help", NULL };
+	static char * const pcHashDup[] = { "set", "show", "SET", NULL };
+	static char * const pcHashFull[] = {				// 17 keywords, all in seed bucket 0 of 9
+		"k1", "k8", "k13", "k16", "k21", "k28", "k35", "k41", "k48", "k67", "k68", "k71", "k78", "k81", "k96", "k103", "k116", NULL
+	};
+	u16_t u16Seed[stringHASH_SEEDS(17)], u16Slot[17];
+	strhash_t sHash;
+	stringTEST_CHECK(xStringHashInit(&sHash, pcHashOK, u16Seed, u16Slot) == erSUCCESS &&
+		xStringHashIndex(&sHash, "STATUS") == 3 && xStringHashIndex(&sHash, "help") == 5 && xStringHashIndex(&sHash, "sho") == erFAILURE);
+	stringTEST_CHECK(xStringHashInit(&sHash, pcHashDup, u16Seed, u16Slot) == erFAILURE);
+	stringTEST_CHECK(xStringHashInit(&sHash, pcHashFull, u16Seed, u16Slot) == erFAILURE);	// > stringHASH_BUCKET_MAX
+	#endif
 }
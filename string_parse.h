@@ -5,6 +5,7 @@
 #include "struct_union.h"
 #include "definitions.h"
 #include "timeX.h"
+#include "string_general.h"
 
 #include <stddef.h>
 #include <stdbool.h>
@@ -31,6 +32,45 @@ extern "C" {
 #define	DATETIME_HMS_MASK			(DATETIME_HOUR_OK | DATETIME_MIN_OK | DATETIME_SEC_OK)
 #define	DATETIME_YMDHMS_MASK		(DATETIME_YMD_MASK | DATETIME_HMS_MASK)
 
+#define	stringSPLIT_KEEP			0x00		// keep empty fields (CSV style)
+#define	stringSPLIT_COLLAPSE		0x01		// skip empty fields, consecutive delimiters act as one
+
+#define	stringDATETIME_MAX			48				// longest date/time string handled by ...N() variant
+#define	stringISO8601_SIZE			sizeof("CCYY-MM-DDThh:mm:ss.ffffffZ")	// incl terminator
+
+// ######################################### Structures ############################################
+
+/**
+ * @brief	context for streaming (chunk by chunk) decoding of percent encoded data
+ */
+typedef struct enc_ctx_t {
+	u8_t State;											// 0 = data, 1 = '%' seen, 2 = '%' & 1st nibble seen
+	u8_t Nibble;										// 1st nibble of escape sequence
+	bool Plus;											// decode '+' as ' ' (HTML form bodies)
+} enc_ctx_t;
+
+/**
+ * @brief	context for parsing a series of timestamps, remembers the last canonical date
+ */
+typedef struct dt_ctx_t {
+	char caDate[10];									// last "CCYY-MM-DD" parsed, not terminated
+	bool Valid;											// caDate and fields below valid
+	u8_t Mon;											// 1 -> 12
+	u8_t MDay;											// 1 -> 31
+	u16_t Year;											// 1970 etc
+	i32_t Days;											// days since 1 Jan YEAR_BASE_MIN
+	u32_t Hits;											// date part reused
+	u32_t Miss;											// date part (re)parsed
+} dt_ctx_t;
+
+/**
+ * @brief	context for formatting a series of timestamps, remembers the last date rendered
+ */
+typedef struct dt_fmt_t {
+	char caDate[11];									// "CCYY-MM-DDT" for Days, not terminated
+	i32_t Days;											// days since 1 Jan YEAR_BASE_MIN, -1 if none
+} dt_fmt_t;
+
 // ########################################## Parse support ########################################
 
 /**
@@ -40,6 +80,16 @@ extern "C" {
  */
 int	xStringParseUnicode(char * pDst, char * pSrc, size_t Len);
 
+/**
+ * @brief	unescape a JSON string value, \" \\ \/ \b \f \n \r \t and \uXXXX (incl surrogate pairs) to UTF-8
+ * @param[out]	pDst - pointer to destination buffer, NULL to decode in place
+ * @param[in]	pSrc - pointer to 1st char after the opening '"'
+ * @param[in]	sDst - size of destination buffer, result terminated if space
+ * @param[out]	ppEnd - if not NULL, set to point to the closing '"' (or NUL if not found)
+ * @return		length of unescaped string, erFAILURE if illegal escape or destination too small
+ */
+int	xStringParseJSON(char * pDst, char * pSrc, size_t sDst, char ** ppEnd);
+
 /**
  * @brief
  * @param[in]
@@ -47,6 +97,31 @@ int	xStringParseUnicode(char * pDst, char * pSrc, size_t Len);
  */
 int	xStringParseEncoded(char * pDst, char * pSrc);
 
+/**
+ * @brief	initialise context for streaming decode of percent encoded data
+ * @param[out]	psCtx - pointer to context
+ * @param[in]	Plus - true to also decode '+' as ' ' (application/x-www-form-urlencoded)
+ */
+void vStringParseEncodedInit(enc_ctx_t * psCtx, bool Plus);
+
+/**
+ * @brief	decode a chunk of percent encoded data, escapes may be split across chunks
+ * @param[in]	psCtx - pointer to context, carries partial escape between calls
+ * @param[out]	pDst - pointer to destination buffer, may be the same as pSrc
+ * @param[in]	sDst - size of destination buffer, output NOT terminated
+ * @param[in]	pSrc - pointer to chunk of encoded data, need not be terminated
+ * @param[in]	sSrc - number of bytes in chunk
+ * @param[out]	pUsed - number of source bytes consumed, less than sSrc if pDst full
+ * @return		number of bytes decoded to pDst or erFAILURE if illegal escape encountered
+ */
+int	xStringParseEncodedChunk(enc_ctx_t * psCtx, char * pDst, size_t sDst, const char * pSrc, size_t sSrc, size_t * pUsed);
+
+/**
+ * @brief	verify that the stream did not end with an incomplete escape sequence
+ * @return	erSUCCESS or erFAILURE if partial escape still pending
+ */
+int	xStringParseEncodedDone(enc_ctx_t * psCtx);
+
 /**
  * @brief	Copies token from source buffer to destination buffer
  * @param	pDst - pointer to destination buffer
@@ -57,6 +132,19 @@ int	xStringParseEncoded(char * pDst, char * pSrc);
  * @return	pointer to next character to be processed...
  */
 char * pcStringParseToken(char * pDst, char * pSrc, const char * pDel, int flag, size_t sDst);
+char * pcStringParseTokenView(strv_t * psTok, char * pSrc, const char * pDel);
+
+/**
+ * @brief	split a line into fields in a single pass
+ * @param[in]	pSrc - pointer to line, ends at NUL or after sSrc characters
+ * @param[in]	sSrc - length of line, 0 if NUL terminated
+ * @param[in]	psDel - pointer to set of field delimiters
+ * @param[in]	Flags - stringSPLIT_KEEP or stringSPLIT_COLLAPSE empty field handling
+ * @param[out]	psFld - pointer to array of fields to be filled
+ * @param[in]	Max - number of entries in psFld, last field holds remainder of line if reached
+ * @return		number of fields filled, 0 if line is empty
+ */
+int	xStringSplitFields(const char * pSrc, size_t sSrc, const delim_set_t * psDel, int Flags, strf_t * psFld, int Max);
 
 /**
  * @brief	Parse value from buffer based on size/format/type specified
@@ -67,6 +155,12 @@ char * pcStringParseToken(char * pDst, char * pSrc, const char * pDel, int flag,
  */
 char * cvParseValue(char * pSrc, cvi_e cvI, px_t pX);
 
+/**
+ * @brief	Same as cvParseValue() but source specified as a (non terminated) string view
+ * @return	Updated pointer (pStr+Len if the complete view was parsed) or pcFAILURE
+ */
+char * cvParseValueView(const strv_t * psView, cvi_e cvI, px_t pX);
+
 /**
  * @brief		Parse range checked value from buffer based on size/format/type specified
  * @param[in]	pSrc - source pointer to take character(s) from
@@ -83,6 +177,21 @@ char * cvParseRangeX32(char * pSrc, px_t pX, cvi_e cvI, x32_t Lo, x32_t Hi);
  */
 char * cvParseRangeX64(char * pSrc, px_t pX, cvi_e cvI, x64_t Lo, x64_t Hi);
 
+/**
+ * @brief		parse a list of values, all of the same type, into an array
+ * @param[in]	pSrc - list, values separated by whitespace and/or a single delimiter
+ * @param[in]	psSet - delimiter set, NULL if only whitespace separated
+ * @param[in]	cvI - type of each value and of the array elements
+ * @param[out]	pX - pointer to array of Max elements
+ * @param[in]	pRange - pointer to Lo & Hi (of the form of cvI) allowed, NULL if not checked
+ * @param[out]	pErr - index of first value invalid, out of range or not followed by a separator,
+ * 				Max if more values than array elements, number of values stored if the list
+ * 				ends with a delimiter (e.g. "1,2,"), erFAILURE if all values stored
+ * @return		number of values stored, all values before the one in error
+ * @note		integers as for pcStringParseInteger(), decimal digits converted 8 at a time
+ */
+int	xStringParseValues(char * pSrc, const delim_set_t * psSet, cvi_e cvI, px_t pX, size_t Max, const x64_t * pRange, int * pErr);
+
 /**
  * pcStringParseDateTime()
  * @brief		parse a string with format	2015-04-01T12:34:56.789Z
@@ -98,7 +207,7 @@ char * cvParseRangeX64(char * pSrc, px_t pX, cvi_e cvI, x64_t Lo, x64_t Hi);
  * 				valid values (if found) in time structure
  * 				0 if no valid milli/second values found
  * @note		tm_isdst not yet calculated/set!!
- * 				Must also add support for following 3 formats as used
+ * 				Also supports the following 3 formats as used
  * 				in HTTP1.1 onwards for "If-Modified-Since" option
  * 					Fri, 31 Dec 1999 23:59:59 GMT (standard going forward)
  *					Friday, 31-Dec-99 23:59:59 GMT
@@ -106,6 +215,74 @@ char * cvParseRangeX64(char * pSrc, px_t pX, cvi_e cvI, x64_t Lo, x64_t Hi);
  */
 char * pcStringParseDateTime(char * buf, u64_t * pTStamp, tm_t * psTM);
 
+/**
+ * @brief	initialise a date/time parsing context, clears counters
+ */
+void vStringParseDateTimeInit(dt_ctx_t * psCtx);
+
+/**
+ * @brief	Same as pcStringParseDateTime() but reuses the date part of the previous canonical
+ * 			CCYY-MM-DDThh:mm:ss[.ffffff][Z] timestamp if the date bytes are unchanged
+ * @param[in]	psCtx - pointer to context, initialised with vStringParseDateTimeInit()
+ * @param[out]	psTM - pointer to tm_t to be filled, NULL if only the timestamp is required
+ * @note		Hits/Miss counters in context show how often the date part was reused
+ */
+char * pcStringParseDateTimeCtx(dt_ctx_t * psCtx, char * pSrc, u64_t * pTStamp, tm_t * psTM);
+
+/**
+ * @brief	parse a column of timestamps, as from xStringSplitFields(), into an array of values
+ * @param[in]	psView - pointer to array of views, one per row, trailing spaces ignored
+ * @param[in]	Count - number of rows
+ * @param[out]	pTStamp - pointer to array of Count timestamps, 0 if row invalid
+ * @param[out]	pValid - pointer to bitmap, (Count + 31) / 32 words, bit set if row valid
+ * @return		number of valid rows
+ * @note		a row is only valid if the complete field is a date/time, context as for
+ * 				pcStringParseDateTimeCtx() kept across rows
+ */
+int	xStringParseDateTimeBatch(const strv_t * psView, size_t Count, u64_t * pTStamp, u32_t * pValid);
+
+/**
+ * @brief	Same as pcStringParseDateTime() but only the timestamp is returned, no tm_t is filled
+ * @note	canonical CCYY-MM-DDThh:mm:ss[.ffffff][Z] converted directly, without any tm_t
+ */
+char * pcStringParseEpoch(char * pSrc, u64_t * pTStamp);
+
+/**
+ * @brief	parse a relative period in a single pass, no tm_t used
+ * 				[Nd][Nh][Nm][Ns][.ffffff]	units in this order, any subset, case ignored
+ * 				[Nd][hh:]mm:ss[.ffffff]		fields after the first < 60
+ * 				N[.ffffff]					seconds only, optional trailing 's'
+ * @param[out]	pUSecs - pointer to duration in microseconds
+ * @return		pointer to next character to be processed, or pcFAILURE if invalid or overflow
+ * @note		a number without unit following a unit (e.g. "1h30") is ambiguous and fails, a
+ * 				fraction with trailing 's' (e.g. "1m30.5s") is accepted as seconds, a fraction
+ * 				followed by d/h/m (e.g. "1.5h") fails
+ */
+char * pcStringParseDuration(char * pSrc, u64_t * pUSecs);
+
+/**
+ * @brief	initialise a date/time formatting context
+ */
+void vStringFormatISO8601Init(dt_fmt_t * psFmt);
+
+/**
+ * @brief	format a timestamp as CCYY-MM-DDThh:mm:ss.ffffffZ, accepted as is by pcStringParseDateTime()
+ * @param[in]	psFmt - pointer to context, initialised with vStringFormatISO8601Init(), date part
+ * 				only rebuilt when the day changes
+ * @param[out]	pBuf - pointer to buffer of at least stringISO8601_SIZE characters
+ * @param[in]	TStamp - microseconds since 1 Jan YEAR_BASE_MIN, at most 2106-02-07T06:28:15.999999Z
+ * 				(SECONDS_IN_EPOCH_FUTURE), the range pcStringParseDateTime() can return
+ * @return		pointer to terminating NUL in pBuf
+ */
+char * pcStringFormatISO8601(dt_fmt_t * psFmt, char * pBuf, u64_t TStamp);
+
+/**
+ * @brief	Same as pcStringParseDateTime() but for a buffer of known size, need not be terminated
+ * @param[in]	sSrc - number of characters available, at most stringDATETIME_MAX examined
+ * @return		pointer into pSrc to next character to be processed, or pcFAILURE
+ */
+char * pcStringParseDateTimeN(char * pSrc, size_t sSrc, u64_t * pTStamp, tm_t * psTM);
+
 /**
  * @brief
  * @param[in]
@@ -0,0 +1,88 @@
+// string_swar.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+#pragma once
+
+#include "struct_union.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ########################################### MACROS ##############################################
+
+/* Word-at-a-time (SWAR) support for the string kernels. Words are only ever loaded from
+ * naturally aligned addresses so a load can never straddle a page or memory region boundary,
+ * even when it extends beyond the terminating NUL. Unaligned loads are only done when
+ * swarPAGE_SAFE() confirms the same. Such a load may read bytes past the end of the object,
+ * never past the page, harmless on the hardware but reported by AddressSanitizer, hence
+ * functions doing them are marked swarKERNEL. */
+
+#define	swarSIZE					sizeof(swar_t)
+#define	swarREP(b)					(((swar_t) -1 / 0xFF) * (u8_t) (b))	// replicate byte across word
+#define	swarREP64(b)				(((u64_t) -1 / 0xFF) * (u8_t) (b))	// same, u64 for 8 byte loads on 32 bit targets
+#define	swarALIGNED(p)				((((uintptr_t) (p)) & (swarSIZE - 1)) == 0)
+#define	swarKERNEL					__attribute__((no_sanitize_address))	// may read past the object, not the page
+
+#ifndef swarPAGE
+	#define	swarPAGE				4096				// smallest protection/region granularity
+#endif
+#define	swarPAGE_SAFE_N(p, n)		((((uintptr_t) (p)) & (swarPAGE - 1)) <= (swarPAGE - (n)))	// unaligned n byte load stays in page
+#define	swarPAGE_SAFE(p)			swarPAGE_SAFE_N(p, swarSIZE)
+
+// ############################################ Types ##############################################
+
+typedef uintptr_t __attribute__((__may_alias__)) swar_t;
+
+// ###################################### Inline functions #########################################
+
+/**
+ * @brief	flag each zero byte in a word, exact (no false positives after a true zero)
+ * @return	word with 0x80 set in each byte position that was zero
+ */
+static inline swar_t xSwarZero(swar_t X) {
+	swar_t T = (X & swarREP(0x7F)) + swarREP(0x7F);
+	return ~(T | X | swarREP(0x7F));
+}
+
+/**
+ * @brief	flag each byte in a word equal to the character specified
+ */
+static inline swar_t xSwarEqual(swar_t X, u8_t cChr) { return xSwarZero(X ^ swarREP(cChr)); }
+
+/**
+ * @brief	flag each byte (all < 0x80) in a word that is greater than or equal to the value specified
+ * @note	result undefined for bytes with the MSB set, caller must mask those out
+ */
+static inline swar_t xSwarGE(swar_t X, u8_t cVal) { return (X + swarREP(0x80 - cVal)) & swarREP(0x80); }
+
+/**
+ * @brief	check if 2 words with difference D (X ^ Y) are equal ignoring ASCII letter case
+ * @note	letters differ only in bit 0x20, any other difference or 0x20 on a non letter is a mismatch
+ */
+static inline bool bSwarFoldEqual(swar_t X, swar_t D) {
+	if (D & ~swarREP(0x20))
+		return false;
+	swar_t L = X | swarREP(0x20);						// fold to lower case
+	swar_t T = L & swarREP(0x7F);
+	swar_t Alpha = xSwarGE(T, 'a') & ~xSwarGE(T, 'z' + 1) & ~L;	// ~L excludes bytes with MSB set
+	return ((D << 2) & ~Alpha) == 0;					// 0x20 -> 0x80 each byte, must be a letter
+}
+
+/**
+ * @brief	index (in memory order) of the first flagged byte in a non-zero mask
+ */
+static inline size_t xSwarFirst(swar_t M) {
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	return __builtin_ctzll((unsigned long long) M) >> 3;
+#else
+	return (__builtin_clzll((unsigned long long) M) - (64 - (swarSIZE * 8))) >> 3;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,95 @@
+// string_timing.h - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+#pragma once
+
+#include "struct_union.h"
+
+#include <stdbool.h>
+
+#if defined(ESP_PLATFORM)
+	#include "esp_cpu.h"
+#elif !defined(__x86_64__) && !defined(__i386__)
+	#include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ########################################### MACROS ##############################################
+
+/* Per function call count, bytes processed and log2 cycle histogram. Enabled per source file by
+ * setting the debugTIMING bit (0x1000) in debugFLAG, this header must be included AFTER debugTIMING
+ * is defined. With debugTIMING 0 the macros expand to nothing, the instrumented functions carry no
+ * timing code or data. The (small) registry and vStringTimingRecord/Report/Reset() are always built.
+ * Registration on 1st call is safe across cores, the counters are not atomic and may lose the odd
+ * update when the same function runs concurrently on both cores. */
+
+#define	stringTIMING_BINS			32					// log2(cycles) 0 -> 31
+
+#if defined(debugTIMING) && (debugTIMING)
+	#define	stringTIMING_START(name, p)														\
+		static strtime_t _sTS = { .pcName = name };											\
+		strtime_ctx_t _sTC __attribute__((cleanup(vStringTimingStop))) = {					\
+			.psStat = &_sTS, .pBeg = (const char *) (p), .Start = xStringCycles(), .Bytes = 0 }
+	#define	stringTIMING_BYTES(n)		_sTC.Bytes = (n)
+	#define	stringTIMING_END(p)			do { if ((p) != pcFAILURE) _sTC.Bytes = (const char *) (p) - _sTC.pBeg; } while (0)
+#else
+	#define	stringTIMING_START(name, p)
+	#define	stringTIMING_BYTES(n)
+	#define	stringTIMING_END(p)
+#endif
+
+// ############################################ Types ##############################################
+
+typedef struct strtime_t {
+	const char * pcName;
+	struct strtime_t * psNext;
+	bool Linked;										// registered on 1st call
+	u32_t Count;
+	u64_t Bytes;
+	u64_t Cycles;
+	u32_t Hist[stringTIMING_BINS];
+} strtime_t;
+
+typedef struct strtime_ctx_t {
+	strtime_t * psStat;
+	const char * pBeg;									// start of input, for stringTIMING_END()
+	u32_t Start;
+	size_t Bytes;
+} strtime_ctx_t;
+
+// ###################################### Public functions #########################################
+
+/**
+ * @brief	add a single call to the statistics of a function
+ */
+void vStringTimingRecord(strtime_t * psStat, u32_t Cycles, size_t Bytes);
+
+// ###################################### Inline functions #########################################
+
+/**
+ * @brief	free running CPU cycle count, wraps, only differences are meaningful
+ */
+static inline u32_t xStringCycles(void) {
+#if defined(ESP_PLATFORM)
+	return esp_cpu_get_cycle_count();					// CCOUNT
+#elif defined(__x86_64__) || defined(__i386__)
+	return (u32_t) __builtin_ia32_rdtsc();
+#else
+	struct timespec sTS;
+	clock_gettime(CLOCK_MONOTONIC, &sTS);
+	return (u32_t) ((sTS.tv_sec * 1000000000ULL) + sTS.tv_nsec);	// ns rather than cycles
+#endif
+}
+
+/**
+ * @brief	scope exit handler for stringTIMING_START(), runs on every return path
+ */
+static inline void vStringTimingStop(strtime_ctx_t * psCtx) {
+	vStringTimingRecord(psCtx->psStat, xStringCycles() - psCtx->Start, psCtx->Bytes);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,6 +5,9 @@
 
 #include "errors_events.h"
 #include <string.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <math.h>
 
 // ########################################### Macros ##############################################
 
@@ -14,6 +17,175 @@
 #define	debugPARAM					(debugFLAG_GLOBAL & debugFLAG & 0x4000)
 #define	debugRESULT					(debugFLAG_GLOBAL & debugFLAG & 0x8000)
 
+#include "string_timing.h"								// after debugTIMING
+
+#define	hexREP(b)					(0x0101010101010101ULL * (u8_t) (b))
+#define	hexGE(X,b)					(((X) + hexREP(0x80 - (b))) & hexREP(0x80))
+#define	hexENTRY(c,v)				[(u8_t) (c)] = (v) + 1
+
+// ######################################## Local variables ########################################
+
+/* Nibble decode table, value+1 stored so that all unspecified entries (0) are invalid.
+ * Includes the O/o -> 0 capture error fix as per xHexCharToValue() */
+static const u8_t u8HexTable[256] = {
+	hexENTRY('0', 0x0), hexENTRY('1', 0x1), hexENTRY('2', 0x2), hexENTRY('3', 0x3),
+	hexENTRY('4', 0x4), hexENTRY('5', 0x5), hexENTRY('6', 0x6), hexENTRY('7', 0x7),
+	hexENTRY('8', 0x8), hexENTRY('9', 0x9),
+	hexENTRY('A', 0xA), hexENTRY('B', 0xB), hexENTRY('C', 0xC), hexENTRY('D', 0xD), hexENTRY('E', 0xE), hexENTRY('F', 0xF),
+	hexENTRY('a', 0xA), hexENTRY('b', 0xB), hexENTRY('c', 0xC), hexENTRY('d', 0xD), hexENTRY('e', 0xE), hexENTRY('f', 0xF),
+	hexENTRY('O', 0x0), hexENTRY('o', 0x0),
+};
+
+/* Powers of 10 exactly representable, for the float fast path (Clinger) */
+static const f64_t f64Pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+static const f32_t f32Pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+// ######################################## Local functions ########################################
+
+/**
+ * @brief	convert pairs of hex characters to bytes using the decode table
+ * @return	erSUCCESS or erFAILURE if an invalid character found
+ */
+static int xParseHexPairs(const char * pSrc, u8_t * pU8, size_t Count) {
+	while (Count--) {
+		int xHi = (int) u8HexTable[(u8_t) *pSrc++] - 1;
+		int xLo = (int) u8HexTable[(u8_t) *pSrc++] - 1;
+		if ((xHi | xLo) < 0)
+			return erFAILURE;
+		*pU8++ = (xHi << 4) | xLo;
+	}
+	return erSUCCESS;
+}
+
+/**
+ * @brief	parse a dotted quad IPv4 address, each octet 1 to 3 decimal digits with value 0 -> 255
+ * @param	pSrc - pointer to 1st digit
+ * @param	pOct - pointer to 4 byte array, octets stored in address order
+ * @return	pointer to 1st char after the address or NULL if invalid
+ */
+static char * pcParseIp4Octets(char * pSrc, u8_t * pOct) {
+	for (int i = 0; i < 4; ++i) {
+		if (i && *pSrc++ != CHR_FULLSTOP)
+			return NULL;
+		int Count = 0, xVal = 0;
+		while (INRANGE(CHR_0, *pSrc, CHR_9)) {
+			if (++Count > 3)
+				return NULL;
+			xVal = (xVal * 10) + *pSrc++ - CHR_0;
+		}
+		if (Count == 0 || xVal > 255)
+			return NULL;
+		pOct[i] = xVal;
+	}
+	return pSrc;
+}
+
+/**
+ * @brief	parse optional "/prefix" CIDR suffix and skip trailing whitespace
+ * @param	pPrefix - pointer to prefix storage, NULL if suffix not allowed
+ * @param	Max - maximum (and default if not present) prefix length
+ * @return	pointer to next char or pcFAILURE if prefix invalid
+ */
+static char * pcParseIpPrefix(char * pSrc, u8_t * pPrefix, int Max) {
+	if (pPrefix) {
+		int xVal = Max;
+		if (*pSrc == CHR_FWDSLASH) {
+			char * pTmp = ++pSrc;
+			xVal = 0;
+			while (INRANGE(CHR_0, *pSrc, CHR_9) && (pSrc - pTmp) < 3)
+				xVal = (xVal * 10) + *pSrc++ - CHR_0;
+			if (pSrc == pTmp || xVal > Max || INRANGE(CHR_0, *pSrc, CHR_9))
+				return pcFAILURE;
+		}
+		*pPrefix = xVal;
+	}
+	while (isspace((int) *pSrc))
+		++pSrc;
+	return pSrc;
+}
+
+/**
+ * @brief	parse the colon separated hex groups of an IPv6 address, "::" expanded to zero groups
+ * @param	pSrc - pointer to 1st char of address
+ * @param	pAddr - pointer to 16 byte array, address stored in network byte order
+ * @return	pointer to 1st char after the address or NULL if invalid
+ */
+static char * pcParseIp6Groups(char * pSrc, u8_t * pAddr) {
+	int Count = 0, Gap = -1;
+	if (*pSrc == CHR_COLON) {							// leading "::"
+		if (*++pSrc != CHR_COLON)
+			return NULL;
+		Gap = 0;
+		++pSrc;
+	}
+	while (Count < 16) {
+		char * pGrp = pSrc;
+		int xVal = 0;
+		while ((pSrc - pGrp) < 4 && isxdigit((int) *pSrc))
+			xVal = (xVal << 4) | (u8HexTable[(u8_t) *pSrc++] - 1);
+		if (isxdigit((int) *pSrc))
+			return NULL;								// more than 4 hex digits
+		if (pSrc == pGrp) {								// no digits, only valid directly after "::"
+			if (Gap != Count)
+				return NULL;
+			break;
+		}
+		if (*pSrc == CHR_FULLSTOP) {					// embedded IPv4 as last 32 bits
+			if (Count > 12 || (pSrc = pcParseIp4Octets(pGrp, pAddr + Count)) == NULL)
+				return NULL;
+			Count += 4;
+			break;
+		}
+		pAddr[Count++] = xVal >> 8;
+		pAddr[Count++] = xVal & 0xFF;
+		if (Count == 16 || *pSrc != CHR_COLON)
+			break;
+		if (*++pSrc == CHR_COLON) {						// "::" compression
+			if (Gap >= 0)
+				return NULL;							// only 1 allowed
+			Gap = Count;
+			++pSrc;
+		}
+	}
+	if (*pSrc == CHR_COLON)
+		return NULL;									// more than 8 groups or trailing ':'
+	if (Gap < 0)
+		return (Count == 16) ? pSrc : NULL;
+	if (Count > 14)
+		return NULL;									// "::" must replace at least 1 group
+	int Fill = 16 - Count;
+	memmove(pAddr + Gap + Fill, pAddr + Gap, Count - Gap);
+	memset(pAddr + Gap, 0, Fill);
+	return pSrc;
+}
+
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+/**
+ * @brief	validate and convert 8 hex characters to 4 bytes, 8 characters in parallel
+ * @return	erSUCCESS or erFAILURE if any character not [0-9A-Fa-f]
+ */
+static int xParseHex8(const char * pSrc, u8_t * pU8) {
+	u64_t X;
+	memcpy(&X, pSrc, sizeof(X));
+	if (X & hexREP(0x80))
+		return erFAILURE;								// non ASCII present
+	u64_t Digit = hexGE(X, CHR_0) & ~hexGE(X, CHR_9 + 1);
+	u64_t Fold = X | hexREP(0x20);						// 'A'-'F' -> 'a'-'f', digits unchanged
+	u64_t Alpha = hexGE(Fold, CHR_a) & ~hexGE(Fold, CHR_f + 1);
+	if ((Digit | Alpha) != hexREP(0x80))
+		return erFAILURE;
+	u64_t Nib = (X & hexREP(0x0F)) + ((Alpha >> 7) * 9);	// nibble value in each byte
+	Nib = ((Nib & 0x00FF00FF00FF00FFULL) << 4) | ((Nib >> 8) & 0x00FF00FF00FF00FFULL);
+	Nib = (Nib | (Nib >> 8)) & 0x0000FFFF0000FFFFULL;
+	u32_t U32 = (Nib | (Nib >> 16));
+	memcpy(pU8, &U32, sizeof(U32));
+	return erSUCCESS;
+}
+#endif
+
 // ###################################### Public functions #########################################
 
 /*
@@ -47,18 +219,9 @@ u64_t char2u64(char * pSrc, u64_t * pDst, int Len) {
  * @return			if valid value, 0x00 -> 0x09 [0x0F] else -1
  */
 int	xHexCharToValue(char cChr, int xBase) {
-	if (INRANGE(CHR_0, cChr, CHR_9))
-		return cChr - CHR_0;
-	if (xBase == BASE16) {
-		if (INRANGE(CHR_A, cChr, CHR_F))
-			return cChr - CHR_A + 10;
-		if (INRANGE(CHR_a, cChr, CHR_f))
-			return cChr - CHR_a + 10;
-		if (cChr == CHR_O || cChr == CHR_o) {			// XXX TEMP fix for capture error
-			return 0;
-		}
-	}
-	return erFAILURE;
+	if (xBase == BASE16)
+		return (int) u8HexTable[(u8_t) cChr] - 1;
+	return INRANGE(CHR_0, cChr, CHR_9) ? cChr - CHR_0 : erFAILURE;
 }
 
 /**
@@ -77,32 +240,65 @@ int xSumHexCharToValue(char cChr, u8_t * pU8) {
 }
 
 /**
- * @brief
- * @param
- * @param
- * @param
- * @return
+ * @brief	convert a hex string, terminated by ' ' or NUL, to bytes
+ * @param	pSrc - pointer to hex string, if odd length 1st char converted to a single byte
+ * @param	pU8 - pointer to destination buffer, cleared before conversion
+ * @param	sU8 - size of destination buffer
+ * @return	number of hex characters converted, erFAILURE if invalid character or buffer too small
  */
 int xParseHexString(char * pSrc, u8_t * pU8, size_t sU8) {
-	char * pTmp = strchr(pSrc, CHR_SPACE);				// ' '  somewhere in string?
-	size_t Len = pTmp ? (pTmp - pSrc) : strlen(pSrc);	// determine input string length
+	size_t Len = strcspn(pSrc, " ");					// determine input string length
+	if (Len == 0)
+		return 0;
+	memset(pU8, 0, sU8);								// clear destination buffer
+	return (xParseHexBuffer(pSrc, Len, pU8, sU8) < 0) ? erFAILURE : (int) Len;
+}
+
+/**
+ * @brief	Same as xParseHexString() but for a buffer of known size, need not be terminated
+ * @param	sSrc - number of characters available, hex string ends at first space or sSrc
+ * @return	number of hex characters consumed, 0 if none, erFAILURE if invalid or buffer too small
+ */
+int xParseHexStringN(const char * pSrc, size_t sSrc, u8_t * pU8, size_t sU8) {
+	const char * pEnd = memchr(pSrc, CHR_SPACE, sSrc);
+	size_t Len = pEnd ? (size_t) (pEnd - pSrc) : sSrc;
 	if (Len == 0)
 		return 0;
 	memset(pU8, 0, sU8);								// clear destination buffer
-	sU8 = Len;											// save source length
-	if (Len & 1) {										// odd input length?
-		if (xSumHexCharToValue(*pSrc++, pU8++) < 0)		// convert a single char
+	return (xParseHexBuffer(pSrc, Len, pU8, sU8) < 0) ? erFAILURE : (int) Len;
+}
+
+/**
+ * @brief	convert a buffer of hex characters, of known length, to bytes
+ * @param	pSrc - pointer to hex characters, need not be terminated
+ * @param	sSrc - number of hex characters, if odd 1st char converted to a single byte
+ * @param	pU8 - pointer to destination buffer
+ * @param	sU8 - size of destination buffer
+ * @return	number of bytes stored, erFAILURE if invalid character or buffer too small
+ */
+int xParseHexBuffer(const char * pSrc, size_t sSrc, u8_t * pU8, size_t sU8) {
+	stringTIMING_START("xParseHexBuffer", pSrc);
+	stringTIMING_BYTES(sSrc);
+	size_t sDst = (sSrc + 1) / 2;
+	if (sDst > sU8)
+		return erFAILURE;
+	if (sSrc & 1) {										// odd input length?
+		int xVal = (int) u8HexTable[(u8_t) *pSrc++] - 1;	// convert a single char
+		if (xVal < 0)
 			return erFAILURE;
-		--Len;
+		*pU8++ = xVal;
+		--sSrc;
 	}
-	while(Len) {
-		if (xSumHexCharToValue(*pSrc++, pU8) < 0)
-			return erFAILURE;
-		if (xSumHexCharToValue(*pSrc++, pU8++) < 0)
-			return erFAILURE;
-		Len -= 2;
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	while (sSrc >= 8) {									// 8 chars -> 4 bytes at a time
+		if (xParseHex8(pSrc, pU8) == erFAILURE && xParseHexPairs(pSrc, pU8, 4) == erFAILURE)
+			return erFAILURE;							// not even valid with O/o fix
+		pSrc += 8;
+		pU8 += 4;
+		sSrc -= 8;
 	}
-	return sU8;
+#endif
+	return (xParseHexPairs(pSrc, pU8, sSrc / 2) == erFAILURE) ? erFAILURE : (int) sDst;
 }
 
 /**
@@ -113,14 +309,14 @@ int xParseHexString(char * pSrc, u8_t * pU8, size_t sU8) {
  * @return
  */
 u64_t xStringParseX64(char *pSrc, char * pDst, int xLen) {
+	stringTIMING_START("xStringParseX64", pSrc);
 	u64_t xTemp = 0;
 	u8_t x8Value = 0;
-	int iRV;
 	while (xLen && *pSrc) {
-		iRV = xHexCharToValue(*pSrc, BASE16);
-		if (iRV == erFAILURE)							// invalid char
+		int xVal = (int) u8HexTable[(u8_t) *pSrc] - 1;
+		if (xVal < 0)									// invalid char
 			break;										// yes, stop parsing
-		x8Value += iRV;									// nope, add to value
+		x8Value += xVal;								// nope, add to value
 		if (xLen % 2) {									// odd length boundary?
 			xTemp <<= 8;
 			xTemp += x8Value;
@@ -132,21 +328,284 @@ u64_t xStringParseX64(char *pSrc, char * pDst, int xLen) {
 		++pSrc;
 		--xLen;
 	}
+	stringTIMING_END(pSrc);
 	return xTemp;
 }
 
+/**
+ * @brief	parse a decimal or [0]x prefixed hexadecimal integer of the form and size specified
+ * @param	pSrc - pointer to string, leading whitespace skipped as with scanf()
+ * @param	cvI - format/size of integer expected, vfUXX or vfIXX only
+ * @param	pX64 - pointer to location where value (sign extended if vfIXX) is to be stored
+ * @return	pointer to 1st char after the value, pcFAILURE if no digits or value outside range of cvI
+ * @note	hex values may use the full width of signed types, 0xFF parsed as cvI08 is -1
+ */
+char * pcStringParseInteger(char * pSrc, cvi_e cvI, x64_t * pX64) {
+	return pcStringParseIntegerN(pSrc, SIZE_MAX, cvI, pX64);
+}
+
+/**
+ * @brief	Same as pcStringParseInteger() but never examines more than sSrc characters
+ * @param	sSrc - maximum number of characters to examine, string need not be terminated
+ */
+char * pcStringParseIntegerN(char * pSrc, size_t sSrc, cvi_e cvI, x64_t * pX64) {
+	stringTIMING_START("pcStringParseIntegerN", pSrc);
+	vf_e cvF = xIndex2Form(cvI);
+	IF_myASSERT(debugPARAM, cvF == vfUXX || cvF == vfIXX);
+	u64_t uMax;
+	switch(xIndex2Size(cvI)) {
+	case vs08B: uMax = UINT8_MAX; break;
+	case vs16B: uMax = UINT16_MAX; break;
+	case vs32B: uMax = UINT32_MAX; break;
+	default:	uMax = UINT64_MAX; break;
+	}
+	while (sSrc && isspace((int) *pSrc)) {
+		++pSrc;
+		--sSrc;
+	}
+	u64_t uVal = 0;
+	char * pTmp;
+	int iHex = (sSrc > 1 && *pSrc == CHR_0 && (pSrc[1] == CHR_x || pSrc[1] == CHR_X)) ? 2 :
+			   (sSrc > 0 && (*pSrc == CHR_x || *pSrc == CHR_X)) ? 1 : 0;
+	if (iHex > 0) {										// [0]x prefix, full width of type
+		pTmp = pSrc += iHex;
+		sSrc -= iHex;
+		while (sSrc && isxdigit((int) *pSrc)) {
+			if (uVal > (uMax >> 4))
+				return pcFAILURE;						// overflow
+			uVal = (uVal << 4) | xHexCharToValue(*pSrc, BASE16);
+			++pSrc;
+			--sSrc;
+		}
+		if (pSrc == pTmp)
+			return pcFAILURE;							// no digits
+		if ((cvF == vfIXX) && (uVal > (uMax >> 1)))		// sign bit set ?
+			uVal |= ~uMax;								// yes, sign extend
+		pX64->u64 = uVal;
+		stringTIMING_END(pSrc);
+		return pSrc;
+	}
+	bool bNeg = false;
+	if (sSrc && (*pSrc == CHR_MINUS || *pSrc == CHR_PLUS)) {
+		bNeg = (*pSrc++ == CHR_MINUS);
+		--sSrc;
+	}
+	if (cvF == vfIXX)
+		uMax = (uMax >> 1) + bNeg;						// 127 or 128 for 8 bit etc
+	pTmp = pSrc;
+	while (sSrc && INRANGE(CHR_0, *pSrc, CHR_9)) {
+		u8_t Digit = *pSrc - CHR_0;
+		if (uVal > ((uMax - Digit) / 10))
+			return pcFAILURE;							// overflow
+		uVal = (uVal * 10) + Digit;
+		++pSrc;
+		--sSrc;
+	}
+	if (pSrc == pTmp)
+		return pcFAILURE;								// no digits
+	if (bNeg) {
+		if (cvF == vfUXX && uVal)
+			return pcFAILURE;							// negative unsigned
+		uVal = -uVal;
+	}
+	pX64->u64 = uVal;
+	stringTIMING_END(pSrc);
+	return pSrc;
+}
+
+/**
+ * @brief	parse a decimal floating point value, correctly rounded to the size specified
+ * @param	pSrc - pointer to string, leading whitespace skipped as with scanf()
+ * @param	cvI - cvF32 or cvF64
+ * @param	pX - pointer to location where f32_t/f64_t value is to be stored
+ * @return	pointer to 1st char after the value, pcFAILURE if no valid value found
+ * @note	[+-]digits[.digits][(e|E)[+-]digits], inf, infinity & nan[(chars)] in any case.
+ * 			Up to 19 significant digits with a small exponent converted exactly with a single
+ * 			multiply or divide, all others (incl hex floats) handed to strtod()/strtof()
+ */
+char * pcStringParseFloat(char * pSrc, cvi_e cvI, px_t pX) {
+	stringTIMING_START("pcStringParseFloat", pSrc);
+	IF_myASSERT(debugPARAM, cvI == cvF32 || cvI == cvF64);
+	char * pRet = pcFAILURE;
+	while (isspace((int) *pSrc))
+		++pSrc;
+	char * pBeg = pSrc;
+	bool bNeg = false;
+	if (*pSrc == CHR_MINUS || *pSrc == CHR_PLUS)
+		bNeg = (*pSrc++ == CHR_MINUS);
+	f64_t F64;
+	if (isalpha((int) *pSrc)) {							// inf, infinity or nan
+		if (xstrncmpNC(pSrc, "inf", 3)) {
+			pSrc += xstrncmpNC(pSrc, "infinity", 8) ? 8 : 3;
+			F64 = INFINITY;
+		} else if (xstrncmpNC(pSrc, "nan", 3)) {
+			pSrc += 3;
+			if (*pSrc == CHR_L_ROUND) {					// optional "(chars)" payload ignored
+				char * pTmp = pSrc + 1;
+				while (isalnum((int) *pTmp) || *pTmp == CHR_UNDERSCORE)
+					++pTmp;
+				if (*pTmp == CHR_R_ROUND)
+					pSrc = pTmp + 1;
+			}
+			F64 = NAN;
+		} else {
+			goto exit;
+		}
+		if (cvI == cvF32)
+			*pX.pf32 = bNeg ? -(f32_t) F64 : (f32_t) F64;
+		else
+			*pX.pf64 = bNeg ? -F64 : F64;
+		pRet = pSrc;
+		goto exit;
+	}
+	if (pSrc[0] == CHR_0 && (pSrc[1] == CHR_x || pSrc[1] == CHR_X))
+		goto slow;										// hex float, rare
+	u64_t Mant = 0;
+	int Digits = 0, Exp = 0;
+	bool bAny = false, bTrunc = false;
+	while (*pSrc == CHR_0) {							// leading 0's not significant
+		++pSrc;
+		bAny = true;
+	}
+	while (isdigit((int) *pSrc)) {
+		if (Digits < 19) {								// 19 digits always fit in u64_t
+			Mant = (Mant * 10) + *pSrc - CHR_0;
+			++Digits;
+		} else {
+			bTrunc |= (*pSrc != CHR_0);
+			++Exp;
+		}
+		++pSrc;
+		bAny = true;
+	}
+	if (*pSrc == CHR_FULLSTOP) {
+		++pSrc;
+		if (Digits == 0) {
+			while (*pSrc == CHR_0) {					// 0.000ddd
+				--Exp;
+				++pSrc;
+				bAny = true;
+			}
+		}
+		while (isdigit((int) *pSrc)) {
+			if (Digits < 19) {
+				Mant = (Mant * 10) + *pSrc - CHR_0;
+				++Digits;
+				--Exp;
+			} else {
+				bTrunc |= (*pSrc != CHR_0);
+			}
+			++pSrc;
+			bAny = true;
+		}
+	}
+	if (bAny == false)
+		goto exit;										// no digits
+	if (*pSrc == CHR_e || *pSrc == CHR_E) {				// exponent only if digits follow
+		char * pTmp = pSrc + 1;
+		bool bNegExp = false;
+		if (*pTmp == CHR_MINUS || *pTmp == CHR_PLUS)
+			bNegExp = (*pTmp++ == CHR_MINUS);
+		if (isdigit((int) *pTmp)) {
+			int Val = 0;
+			while (isdigit((int) *pTmp)) {
+				if (Val < 100000)						// far beyond any range, stop growing
+					Val = (Val * 10) + *pTmp - CHR_0;
+				++pTmp;
+			}
+			Exp += bNegExp ? -Val : Val;
+			pSrc = pTmp;
+		}
+	}
+	if (bTrunc == false) {
+		if (Mant == 0) {
+			if (cvI == cvF32)
+				*pX.pf32 = bNeg ? -0.0f : 0.0f;
+			else
+				*pX.pf64 = bNeg ? -0.0 : 0.0;
+			pRet = pSrc;
+			goto exit;
+		}
+		if (cvI == cvF32 && Mant <= (1ULL << 24) && INRANGE(-10, Exp, 10)) {
+			f32_t F32 = (f32_t) Mant;					// exact, as is the power of 10
+			F32 = (Exp < 0) ? F32 / f32Pow10[-Exp] : F32 * f32Pow10[Exp];
+			*pX.pf32 = bNeg ? -F32 : F32;
+			pRet = pSrc;
+			goto exit;
+		}
+		if (cvI == cvF64 && Mant <= (1ULL << 53) && INRANGE(-22, Exp, 22)) {
+			F64 = (f64_t) Mant;
+			F64 = (Exp < 0) ? F64 / f64Pow10[-Exp] : F64 * f64Pow10[Exp];
+			*pX.pf64 = bNeg ? -F64 : F64;
+			pRet = pSrc;
+			goto exit;
+		}
+	}
+slow:
+	if (cvI == cvF32)
+		*pX.pf32 = strtof(pBeg, &pRet);
+	else
+		*pX.pf64 = strtod(pBeg, &pRet);
+	if (pRet == pBeg)
+		pRet = pcFAILURE;
+exit:
+	stringTIMING_END(pRet);
+	return pRet;
+}
+
 /**
  * @brief	parse a string and return an IP address in NETWORK byte order
  * @param	pStr
  * @param	pVal
- * @return	pcFAILURE or pointer to 1st char after the IP address
+ * @return	pcFAILURE or pointer to 1st char after the IP address (and trailing whitespace)
  */
 char * pcStringParseIpAddr(char * pSrc, px_t pX) {
-	int Len;
-	int iRV = sscanf(pSrc, "%hhu.%hhu.%hhu.%hhu %n", pX.pu8+3, pX.pu8+2, pX.pu8+1, pX.pu8, &Len);
-	if (iRV != 4) {
+	return pcStringParseIpCIDR(pSrc, pX, NULL);
+}
+
+/**
+ * @brief	parse IPv4 address with optional CIDR "/prefix" suffix
+ * @param	pSrc - pointer to string, leading whitespace skipped
+ * @param	pX - pointer to u32_t where address stored, as for pcStringParseIpAddr()
+ * @param	pPrefix - pointer to prefix length (0 -> 32, 32 if no suffix), NULL if suffix not allowed
+ * @return	pcFAILURE or pointer to 1st char after the address, prefix and trailing whitespace
+ */
+char * pcStringParseIpCIDR(char * pSrc, px_t pX, u8_t * pPrefix) {
+	stringTIMING_START("pcStringParseIpCIDR", pSrc);
+	u8_t Oct[4];
+	while (isspace((int) *pSrc))
+		++pSrc;
+	char * pTmp = pcParseIp4Octets(pSrc, Oct);
+	if (pTmp == NULL || (pTmp = pcParseIpPrefix(pTmp, pPrefix, 32)) == pcFAILURE) {
+		MARK_M(pSrc);
+		return pcFAILURE;
+	}
+	pX.pu8[3] = Oct[0];
+	pX.pu8[2] = Oct[1];
+	pX.pu8[1] = Oct[2];
+	pX.pu8[0] = Oct[3];
+	stringTIMING_END(pTmp);
+	return pTmp;
+}
+
+/**
+ * @brief	parse IPv6 address, including "::" compression and embedded IPv4, with optional "/prefix"
+ * @param	pSrc - pointer to string, leading whitespace skipped
+ * @param	pX - pointer to 16 byte array where address stored in network byte order
+ * @param	pPrefix - pointer to prefix length (0 -> 128, 128 if no suffix), NULL if suffix not allowed
+ * @return	pcFAILURE or pointer to 1st char after the address, prefix and trailing whitespace
+ */
+char * pcStringParseIp6Addr(char * pSrc, px_t pX, u8_t * pPrefix) {
+	stringTIMING_START("pcStringParseIp6Addr", pSrc);
+	u8_t Addr[16];
+	while (isspace((int) *pSrc))
+		++pSrc;
+	char * pTmp = pcParseIp6Groups(pSrc, Addr);
+	if (pTmp == NULL || (pTmp = pcParseIpPrefix(pTmp, pPrefix, 128)) == pcFAILURE) {
 		MARK_M(pSrc);
 		return pcFAILURE;
 	}
-	return pSrc += Len;
+	memcpy(pX.pu8, Addr, sizeof(Addr));
+	stringTIMING_END(pTmp);
+	return pTmp;
 }
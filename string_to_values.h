@@ -15,8 +15,15 @@ u64_t xStringParseX64(char *, char *, int) ;
 int	xHexCharToValue(char, int);
 int xSumHexCharToValue(char cChr, u8_t * pU8);
 int xParseHexString(char * pSrc, u8_t * pU8, size_t sU8);
+int xParseHexBuffer(const char * pSrc, size_t sSrc, u8_t * pU8, size_t sU8);
+int xParseHexStringN(const char * pSrc, size_t sSrc, u8_t * pU8, size_t sU8);
+char * pcStringParseInteger(char * pSrc, cvi_e cvI, x64_t * pX64);
+char * pcStringParseIntegerN(char * pSrc, size_t sSrc, cvi_e cvI, x64_t * pX64);
+char * pcStringParseFloat(char * pSrc, cvi_e cvI, px_t pX);
 
 char * pcStringParseIpAddr(char * pStr, px_t px);
+char * pcStringParseIpCIDR(char * pSrc, px_t pX, u8_t * pPrefix);
+char * pcStringParseIp6Addr(char * pSrc, px_t pX, u8_t * pPrefix);
 
 #ifdef __cplusplus
 }
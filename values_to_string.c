@@ -0,0 +1,139 @@
+// values_to_string.c - Copyright (c) 2014-25 Andre M. Maree / KSS Technologies (Pty) Ltd.
+
+#include "hal_platform.h"
+#include "hal_memory.h"
+#include "printfx.h"
+#include "errors_events.h"
+#include "values_to_string.h"
+
+#include <string.h>
+
+// ########################################### Macros ##############################################
+
+#define	debugFLAG					0x6000
+#define	debugTIMING					(debugFLAG_GLOBAL & debugFLAG & 0x1000)
+#define	debugTRACK					(debugFLAG_GLOBAL & debugFLAG & 0x2000)
+#define	debugPARAM					(debugFLAG_GLOBAL & debugFLAG & 0x4000)
+#define	debugRESULT					(debugFLAG_GLOBAL & debugFLAG & 0x8000)
+
+#define	valCHUNK					100000000UL			// 8 decimal digits, fits in u32_t
+
+// ####################################### Global variables ########################################
+
+const char caDigitPairs[200] = {
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+const u64_t u64Pow10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+	1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+	1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+// ######################################## Local variables ########################################
+
+static const char caHexLower[16] = "0123456789abcdef";
+static const char caHexUpper[16] = "0123456789ABCDEF";
+
+// ######################################## Local functions ########################################
+
+/**
+ * @brief	write value backwards from pEnd, 2 digits per step, exactly Digits characters
+ * @note	leading 0's written if Digits exceeds the digits in the value
+ */
+static void vStringPutDec32(char * pEnd, u32_t U32, int Digits) {
+	while (Digits >= 2) {
+		pEnd -= 2;
+		memcpy(pEnd, &caDigitPairs[(U32 % 100) * 2], 2);
+		U32 /= 100;
+		Digits -= 2;
+	}
+	if (Digits)
+		*--pEnd = CHR_0 + U32;
+}
+
+// ###################################### Public functions #########################################
+
+int	xStringDigitsU32(u32_t U32) { return xStringDigitsU64(U32); }
+
+int	xStringDigitsU64(u64_t U64) {
+	int Digits = ((64 - __builtin_clzll(U64 | 1)) * 1233) >> 12;	// log10(2) ~ 1233/4096
+	return Digits + (U64 >= u64Pow10[Digits]) + (U64 == 0);
+}
+
+int	xStringU32ToDec(char * pBuf, u32_t U32) {
+	int Digits = xStringDigitsU32(U32);
+	vStringPutDec32(pBuf + Digits, U32, Digits);
+	return Digits;
+}
+
+int	xStringU64ToDec(char * pBuf, u64_t U64) {
+	if (U64 <= UINT32_MAX)
+		return xStringU32ToDec(pBuf, U64);				// avoid 64 bit divisions
+	int Digits = xStringDigitsU64(U64);
+	char * pEnd = pBuf + Digits;
+	while (U64 > UINT32_MAX) {							// 8 digit chunks, 64 bit division once each
+		vStringPutDec32(pEnd, U64 % valCHUNK, 8);
+		U64 /= valCHUNK;
+		pEnd -= 8;
+	}
+	vStringPutDec32(pEnd, U64, pEnd - pBuf);
+	return Digits;
+}
+
+int	xStringI32ToDec(char * pBuf, i32_t I32) {
+	if (I32 >= 0)
+		return xStringU32ToDec(pBuf, I32);
+	*pBuf = CHR_MINUS;
+	return xStringU32ToDec(pBuf + 1, 0U - (u32_t) I32) + 1;	// INT32_MIN safe
+}
+
+int	xStringI64ToDec(char * pBuf, i64_t I64) {
+	if (I64 >= 0)
+		return xStringU64ToDec(pBuf, I64);
+	*pBuf = CHR_MINUS;
+	return xStringU64ToDec(pBuf + 1, 0ULL - (u64_t) I64) + 1;
+}
+
+int	xStringU64ToHex(char * pBuf, u64_t U64, int Width, bool Upper) {
+	IF_myASSERT(debugPARAM, INRANGE(1, Width, 16));
+	const char * pcHex = Upper ? caHexUpper : caHexLower;
+	for (int i = Width - 1; i >= 0; --i) {
+		pBuf[i] = pcHex[U64 & 0x0F];
+		U64 >>= 4;
+	}
+	return Width;
+}
+
+int	xStringValueToText(char * pBuf, size_t sBuf, cvi_e cvI, px_t pX) {
+	IF_myASSERT(debugPARAM, halMemorySRAM((void*) pBuf) && halMemoryANY(pX.pv));
+	char caBuf[stringVALUE_MAX + 1];					// +1 for snprintfx() terminator
+	int Len;
+	switch (cvI) {
+	case cvU08:	Len = xStringU32ToDec(caBuf, *pX.pu8);		break;
+	case cvU16:	Len = xStringU32ToDec(caBuf, *pX.pu16);		break;
+	case cvU32:	Len = xStringU32ToDec(caBuf, *pX.pu32);		break;
+	case cvU64:	Len = xStringU64ToDec(caBuf, *pX.pu64);		break;
+	case cvI08:	Len = xStringI32ToDec(caBuf, *pX.pi8);		break;
+	case cvI16:	Len = xStringI32ToDec(caBuf, *pX.pi16);		break;
+	case cvI32:	Len = xStringI32ToDec(caBuf, *pX.pi32);		break;
+	case cvI64:	Len = xStringI64ToDec(caBuf, *pX.pi64);		break;
+	case cvF32:	Len = snprintfx(caBuf, sizeof(caBuf), "%.9g", (double) *pX.pf32);	break;
+	case cvF64:	Len = snprintfx(caBuf, sizeof(caBuf), "%.17g", *pX.pf64);			break;
+	default:	return erFAILURE;
+	}
+	if (Len < 0 || (size_t) Len > sBuf)
+		return erFAILURE;
+	memcpy(pBuf, caBuf, Len);
+	return Len;
+}
@@ -0,0 +1,61 @@
+// values_to_string.h
+
+#pragma once
+
+#include "struct_union.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ########################################### Macros ##############################################
+
+#define	stringVALUE_MAX				24					// largest integer/float as text, not terminated
+
+// ####################################### Global variables ########################################
+
+extern const char caDigitPairs[200];					// "00" -> "99", 2 characters per value
+extern const u64_t u64Pow10[20];						// 10^0 -> 10^19
+
+// ################################### Public functions ############################################
+
+/**
+ * @brief	number of decimal digits required for a value, 0 requires 1 digit
+ */
+int	xStringDigitsU32(u32_t U32);
+int	xStringDigitsU64(u64_t U64);
+
+/**
+ * @brief	write value as decimal, 2 digits per step, sign ('-') only if negative
+ * @param[out]	pBuf - pointer to buffer, at least xStringDigitsXXX() (+1 if signed) characters
+ * @return		number of characters written, buffer NOT terminated
+ */
+int	xStringU32ToDec(char * pBuf, u32_t U32);
+int	xStringU64ToDec(char * pBuf, u64_t U64);
+int	xStringI32ToDec(char * pBuf, i32_t I32);
+int	xStringI64ToDec(char * pBuf, i64_t I64);
+
+/**
+ * @brief	write the low order Width nibbles of a value as hex, leading 0's included
+ * @param[in]	Width - number of hex digits, 1 -> 16
+ * @param[in]	Upper - true for A->F, false for a->f
+ * @return		number of characters written (Width), buffer NOT terminated
+ */
+int	xStringU64ToHex(char * pBuf, u64_t U64, int Width, bool Upper);
+
+/**
+ * @brief	write a value, of type as used by cvParseValue(), as decimal text
+ * @param[out]	pBuf - pointer to buffer of sBuf characters, stringVALUE_MAX always sufficient
+ * @param[in]	cvI - type of value, cvU08 -> cvF64
+ * @param[in]	pX - pointer to value
+ * @return		number of characters written (NOT terminated) or erFAILURE if invalid type or sBuf too small
+ * @note		floats use snprintfx() with the full precision of the type, all integer types without
+ */
+int	xStringValueToText(char * pBuf, size_t sBuf, cvi_e cvI, px_t pX);
+
+#ifdef __cplusplus
+}
+#endif